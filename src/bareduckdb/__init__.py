@@ -16,6 +16,7 @@ except ImportError:
 
 from .compat.connection_compat import Connection
 from .core.connection_base import ConnectionBase
+from .core.shared_result import free_shared_result, read_shared_result, read_shared_result_reader, write_shared_result
 
 logger = logging.getLogger(__name__)
 
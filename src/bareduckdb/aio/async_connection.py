@@ -97,3 +97,28 @@ class AsyncConnectionPool:
         finally:
             # Return connection to pool
             await self._available.put(conn)
+
+    async def execute_pending(self, query: str) -> Any:
+        """
+        Execute SQL query via DuckDB's pending-query API.
+
+        Runs one execution task unit per event-loop iteration and yields
+        between units, so hundreds of in-flight queries multiplex on the
+        event loop thread instead of each occupying a thread-pool slot.
+
+        Parameters and replacement-scan data are not supported - use
+        execute() for those.
+        """
+        if not self._executor:
+            raise RuntimeError("Connection pool not initialized. Use 'async with AsyncConnectionPool()' context manager.")
+
+        conn = await self._available.get()
+
+        try:
+            pending = conn._pending_call(query)  # type: ignore[reportPrivateUsage]
+            while not pending.poll():
+                # Yield to the event loop between execution task units
+                await asyncio.sleep(0)
+            return pending.get_result().to_arrow()
+        finally:
+            await self._available.put(conn)
@@ -28,6 +28,34 @@ typedef struct {
     const char* str_val;
 } HolderFilterValue;
 
+/* Expression-tree pushdown vocabulary for TableFilterType EXPRESSION_FILTER.
+   A deliberately small set of node kinds that holders can translate to
+   native expressions (Polars/pyarrow): the filtered column, constants,
+   comparisons, integer/float arithmetic, string prefix/suffix/contains and
+   date_trunc. Anything DuckDB pushes that falls outside this set converts
+   to a missing tree and the holder treats the filter as pass-through. */
+#define HOLDER_EXPR_COLUMN 1     /* the column this filter is attached to */
+#define HOLDER_EXPR_CONST 2      /* literal; value field is set */
+#define HOLDER_EXPR_COMPARE 3    /* children[0] <op> children[1] */
+#define HOLDER_EXPR_ADD 4
+#define HOLDER_EXPR_SUB 5
+#define HOLDER_EXPR_MUL 6
+#define HOLDER_EXPR_PREFIX 7     /* children[0] starts with aux */
+#define HOLDER_EXPR_SUFFIX 8     /* children[0] ends with aux */
+#define HOLDER_EXPR_CONTAINS 9   /* children[0] contains aux */
+#define HOLDER_EXPR_DATE_TRUNC 10 /* children[0] truncated to part aux */
+#define HOLDER_EXPR_AND 11
+#define HOLDER_EXPR_OR 12
+
+typedef struct HolderFilterExpr {
+    int expr_op;             /* HOLDER_EXPR_* */
+    int comparison_type;     /* DuckDB ExpressionType, for HOLDER_EXPR_COMPARE */
+    HolderFilterValue value; /* for HOLDER_EXPR_CONST */
+    const char* aux;         /* prefix/suffix/contains literal or date part */
+    size_t num_children;
+    struct HolderFilterExpr* children;
+} HolderFilterExpr;
+
 struct HolderFilterInfo;
 
 typedef struct HolderFilterInfo {
@@ -40,6 +68,19 @@ typedef struct HolderFilterInfo {
     struct HolderFilterInfo* struct_child_filter;
     size_t num_values;
     HolderFilterValue* in_values;
+    /* Large homogeneous IN-lists are additionally packed as one contiguous
+       typed buffer so the holder gets a single array instead of num_values
+       marshalled elements. in_buffer_kind mirrors HolderFilterValue
+       value_type: 0 = not packed, 2 = int64, 3 = float64, 4 = UTF-8 strings
+       (concatenated bytes plus num_values + 1 offsets). */
+    int in_buffer_kind;
+    const int64_t* in_int_buffer;
+    const double* in_float_buffer;
+    const char* in_str_buffer;
+    const int32_t* in_str_offsets;
+    /* Expression tree for EXPRESSION_FILTER; NULL when the pushed
+       expression uses vocabulary the converter doesn't cover. */
+    HolderFilterExpr* expr;
 } HolderFilterInfo;
 
 typedef struct {
@@ -59,7 +100,29 @@ typedef struct {
     void* capsule_pyobj;
 } HolderProduceResult;
 
+typedef struct {
+    size_t max_streams;      /* capacity of the arrays below, set by caller */
+    size_t num_streams;      /* filled by the callback; 0 means "use single-stream path" */
+    void** stream_ptrs;      /* ArrowArrayStream*, one per partition */
+    void** capsule_pyobjs;   /* owning PyCapsule per stream, released when stream is done */
+} HolderPartitionedProduceResult;
+
+/* One entry in a batch registration (register_holders_batch_cpp). */
+typedef struct {
+    void* holder_pyobj;
+    const char* view_name;
+    size_t stats_count;
+    const ColumnStatsInput* stats;
+    size_t num_columns;
+    const char** column_names;
+    int64_t num_rows;
+    bool supports_views;
+    bool use_partitioned;
+    bool use_deferred_release;
+} HolderRegistration;
+
 typedef HolderProduceResult (*holder_produce_callback_t)(void* holder_ptr, HolderProduceParams* params);
+typedef void (*holder_produce_partitioned_callback_t)(void* holder_ptr, HolderProduceParams* params, HolderPartitionedProduceResult* out);
 typedef void (*holder_release_capsule_callback_t)(void* capsule_pyobj);
 typedef void (*holder_get_schema_callback_t)(void* holder_ptr, void* out_schema);
 
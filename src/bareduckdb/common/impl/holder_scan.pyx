@@ -3,7 +3,8 @@
 
 from cpython.ref cimport PyObject, Py_INCREF, Py_DECREF
 from cpython.pycapsule cimport PyCapsule_GetPointer
-from libc.stdint cimport int64_t, uint32_t
+from cpython.bytes cimport PyBytes_FromStringAndSize
+from libc.stdint cimport int32_t, int64_t, uint32_t
 from libc.stdlib cimport malloc, free
 from libc.string cimport memset
 from libcpp cimport bool as cpp_bool
@@ -36,6 +37,14 @@ cdef extern from "unified_data_scan.hpp":
         double float_val
         const char* str_val
 
+    ctypedef struct HolderFilterExpr:
+        int expr_op
+        int comparison_type
+        HolderFilterValue value
+        const char* aux
+        size_t num_children
+        HolderFilterExpr* children
+
     ctypedef struct HolderFilterInfo:
         int filter_type
         int comparison_type
@@ -46,6 +55,12 @@ cdef extern from "unified_data_scan.hpp":
         HolderFilterInfo* struct_child_filter
         size_t num_values
         HolderFilterValue* in_values
+        int in_buffer_kind
+        const int64_t* in_int_buffer
+        const double* in_float_buffer
+        const char* in_str_buffer
+        const int32_t* in_str_offsets
+        HolderFilterExpr* expr
 
     ctypedef struct HolderColumnFilter:
         size_t col_idx
@@ -61,7 +76,26 @@ cdef extern from "unified_data_scan.hpp":
         void* stream_ptr
         void* capsule_pyobj
 
+    ctypedef struct HolderRegistration:
+        void* holder_pyobj
+        const char* view_name
+        size_t stats_count
+        const ColumnStatsInput* stats
+        size_t num_columns
+        const char** column_names
+        int64_t num_rows
+        cpp_bool supports_views
+        cpp_bool use_partitioned
+        cpp_bool use_deferred_release
+
+    ctypedef struct HolderPartitionedProduceResult:
+        size_t max_streams
+        size_t num_streams
+        void** stream_ptrs
+        void** capsule_pyobjs
+
 ctypedef HolderProduceResult (*holder_produce_callback_t)(void* holder_ptr, HolderProduceParams* params) noexcept nogil
+ctypedef void (*holder_produce_partitioned_callback_t)(void* holder_ptr, HolderProduceParams* params, HolderPartitionedProduceResult* out) noexcept nogil
 ctypedef void (*holder_release_capsule_callback_t)(void* capsule_pyobj) noexcept nogil
 
 cdef extern from "unified_data_scan.hpp" namespace "bareduckdb":
@@ -73,6 +107,7 @@ cdef extern from "unified_data_scan.hpp" namespace "bareduckdb":
         size_t stats_count,
         ColumnStatsInput* stats,
         holder_produce_callback_t callback,
+        holder_produce_partitioned_callback_t partitioned_callback,
         holder_release_capsule_callback_t release_callback,
         void* get_schema_callback,  # unused, pass NULL
         size_t num_columns,
@@ -84,6 +119,41 @@ cdef extern from "unified_data_scan.hpp" namespace "bareduckdb":
 
     void delete_holder_factory_cpp(void* factory_ptr) except +
 
+    void holder_factory_set_accounting(void* factory_ptr, void* accounting_ptr) nogil
+
+    size_t register_holders_batch_cpp(
+        duckdb_connection c_conn,
+        const HolderRegistration* regs,
+        size_t num_regs,
+        holder_produce_callback_t callback,
+        holder_produce_partitioned_callback_t partitioned_callback,
+        holder_release_capsule_callback_t release_callback,
+        cpp_bool replace,
+        const char* function_name,
+        void** out_factories
+    ) except +
+
+    void* update_holder_cpp(
+        void* factory_ptr,
+        void* new_holder_pyobj,
+        int64_t num_rows,
+        size_t stats_count,
+        const ColumnStatsInput* stats
+    ) except +
+
+    cpp_bool add_preexported_stream_cpp(
+        void* factory_ptr,
+        void* stream_ptr,
+        void* capsule_pyobj
+    ) except +
+
+    cpp_bool compute_arrow_column_stats(
+        void* schema_ptr,
+        void** chunk_ptrs,
+        size_t num_chunks,
+        ColumnStatsInput* out
+    ) nogil
+
 cdef extern from "unified_data_scan.hpp" namespace "duckdb":
     void register_holder_scan(DuckDBConnection* cpp_conn, const char* scan_name) except +
 
@@ -98,6 +168,7 @@ DEF FILTER_STRUCT_EXTRACT = 5
 DEF FILTER_OPTIONAL = 6
 DEF FILTER_IN = 7
 DEF FILTER_DYNAMIC = 8
+DEF FILTER_EXPRESSION = 9
 
 # Value type constants
 DEF VALUE_NULL = 0
@@ -124,6 +195,26 @@ cdef object _convert_filter_value(HolderFilterValue* val):
     return None
 
 
+cdef dict _convert_filter_expr(HolderFilterExpr* e):
+    """Convert an expression-filter tree to nested dicts recursively."""
+    cdef dict result = {"op": e.expr_op}
+    cdef list children
+    cdef size_t i
+
+    if e.comparison_type != 0:
+        result["comparison"] = e.comparison_type
+    if e.expr_op == 2:  # HOLDER_EXPR_CONST
+        result["value"] = _convert_filter_value(&e.value)
+    if e.aux != NULL:
+        result["aux"] = e.aux.decode("utf-8")
+    if e.num_children > 0:
+        children = []
+        for i in range(e.num_children):
+            children.append(_convert_filter_expr(&e.children[i]))
+        result["children"] = children
+    return result
+
+
 cdef dict _convert_filter_info(HolderFilterInfo* f):
     """Convert C filter info to Python dict recursively."""
     cdef dict result = {"type": f.filter_type}
@@ -147,10 +238,37 @@ cdef dict _convert_filter_info(HolderFilterInfo* f):
             result["child_filter"] = _convert_filter_info(f.struct_child_filter)
 
     elif f.filter_type == FILTER_IN:
-        values = []
-        for i in range(f.num_values):
-            values.append(_convert_filter_value(&f.in_values[i]))
-        result["values"] = values
+        # Large homogeneous IN-lists arrive packed as one contiguous typed
+        # buffer; copy it into a single bytes object instead of marshalling
+        # one Python object per element. Holders rebuild it as one array.
+        if f.in_buffer_kind == VALUE_INT and f.in_int_buffer != NULL:
+            result["values_kind"] = "int64"
+            result["values_count"] = f.num_values
+            result["values_buffer"] = PyBytes_FromStringAndSize(
+                <const char*>f.in_int_buffer, f.num_values * sizeof(int64_t))
+        elif f.in_buffer_kind == VALUE_FLOAT and f.in_float_buffer != NULL:
+            result["values_kind"] = "float64"
+            result["values_count"] = f.num_values
+            result["values_buffer"] = PyBytes_FromStringAndSize(
+                <const char*>f.in_float_buffer, f.num_values * sizeof(double))
+        elif f.in_buffer_kind == VALUE_STRING and f.in_str_buffer != NULL and f.in_str_offsets != NULL:
+            result["values_kind"] = "string"
+            result["values_count"] = f.num_values
+            result["values_offsets"] = PyBytes_FromStringAndSize(
+                <const char*>f.in_str_offsets, (f.num_values + 1) * sizeof(int32_t))
+            result["values_buffer"] = PyBytes_FromStringAndSize(
+                f.in_str_buffer, f.in_str_offsets[f.num_values])
+        else:
+            values = []
+            for i in range(f.num_values):
+                values.append(_convert_filter_value(&f.in_values[i]))
+            result["values"] = values
+
+    elif f.filter_type == FILTER_EXPRESSION:
+        # expr stays absent when the C++ converter couldn't represent the
+        # pushed expression; holders then treat the filter as pass-through
+        if f.expr != NULL:
+            result["expr"] = _convert_filter_expr(f.expr)
 
     return result
 
@@ -190,15 +308,92 @@ cdef void release_capsule_callback(void* capsule_pyobj) noexcept nogil:
             Py_DECREF(<object>capsule_pyobj)
 
 
+cdef void produce_partitioned_callback(
+    void* holder_ptr,
+    HolderProduceParams* params,
+    HolderPartitionedProduceResult* out
+) noexcept nogil:
+    """
+    Callback from C++ to produce N independent partition streams.
+
+    Leaves out.num_streams at 0 when the holder declines partitioning,
+    which makes C++ fall back to the single-stream produce path.
+    """
+    with gil:
+        _produce_partitioned_with_gil(holder_ptr, params, out)
+
+
+cdef tuple _convert_produce_params(HolderProduceParams* params):
+    """Convert C produce params to (projected_columns, filters)."""
+    cdef list projected_columns = None
+    cdef dict filters = None
+    cdef size_t i
+
+    if params.num_projected_cols > 0 and params.projected_col_names != NULL:
+        projected_columns = []
+        for i in range(params.num_projected_cols):
+            if params.projected_col_names[i] != NULL:
+                projected_columns.append(
+                    params.projected_col_names[i].decode("utf-8")
+                )
+
+    if params.num_filters > 0 and params.filters != NULL:
+        filters = {}
+        for i in range(params.num_filters):
+            col_idx = params.filters[i].col_idx
+            filter_dict = _convert_filter_info(&params.filters[i].filter)
+            filters[col_idx] = filter_dict
+
+    return projected_columns, filters
+
+
+cdef void _produce_partitioned_with_gil(
+    void* holder_ptr,
+    HolderProduceParams* params,
+    HolderPartitionedProduceResult* out
+):
+    """Inner partitioned produce that runs with GIL held."""
+    cdef object holder = <object>holder_ptr
+    cdef size_t i
+    cdef object capsule
+    cdef void* stream_ptr
+    out.num_streams = 0
+
+    try:
+        projected_columns, filters = _convert_produce_params(params)
+
+        capsules = holder.produce_filtered_partitioned(
+            projected_columns, filters, out.max_streams
+        )
+        if not capsules:
+            return
+
+        if len(capsules) > out.max_streams:
+            raise ValueError(
+                f"Holder returned {len(capsules)} partitions, max is {out.max_streams}"
+            )
+
+        for i, capsule in enumerate(capsules):
+            stream_ptr = PyCapsule_GetPointer(capsule, "arrow_array_stream")
+            # Keep each capsule alive while its partition stream is consumed;
+            # released via the deferred-release queue when the stream finishes
+            Py_INCREF(capsule)
+            out.stream_ptrs[i] = stream_ptr
+            out.capsule_pyobjs[i] = <void*><PyObject*>capsule
+        out.num_streams = len(capsules)
+
+    except Exception as e:
+        import sys
+        print(f"Error in produce_partitioned_callback: {e}", file=sys.stderr)
+        out.num_streams = 0
+
+
 cdef HolderProduceResult _produce_with_gil(
     void* holder_ptr,
     HolderProduceParams* params
 ):
     """Inner function that runs with GIL held."""
     cdef object holder = <object>holder_ptr
-    cdef list projected_columns = None
-    cdef dict filters = None
-    cdef size_t i
     cdef object capsule
     cdef void* stream_ptr
     cdef HolderProduceResult result
@@ -206,22 +401,7 @@ cdef HolderProduceResult _produce_with_gil(
     result.capsule_pyobj = NULL
 
     try:
-        # Convert projected columns
-        if params.num_projected_cols > 0 and params.projected_col_names != NULL:
-            projected_columns = []
-            for i in range(params.num_projected_cols):
-                if params.projected_col_names[i] != NULL:
-                    projected_columns.append(
-                        params.projected_col_names[i].decode("utf-8")
-                    )
-
-        # Convert filters
-        if params.num_filters > 0 and params.filters != NULL:
-            filters = {}
-            for i in range(params.num_filters):
-                col_idx = params.filters[i].col_idx
-                filter_dict = _convert_filter_info(&params.filters[i].filter)
-                filters[col_idx] = filter_dict
+        projected_columns, filters = _convert_produce_params(params)
 
         # Call Python holder's produce method
         # Try produce_filtered first (new API), fall back to produce_filtered_stream (old API)
@@ -248,6 +428,92 @@ cdef HolderProduceResult _produce_with_gil(
         return result
 
 
+def compute_column_stats_pyx(int col_index, object schema_capsule, list array_capsules):
+    """
+    Native statistics for one column: walks the chunks' Arrow buffers in
+    C++ with the GIL released (validity bitmaps via popcount, min/max via
+    typed buffer scans).
+
+    Args:
+        col_index: Column index in the source schema
+        schema_capsule: "arrow_schema" PyCapsule for the column type
+        array_capsules: List of "arrow_array" PyCapsules, one per chunk
+
+    Returns:
+        A stats tuple matching compute_statistics output, or None when the
+        column type has no native kernel (caller falls back to the
+        Python-side pass).
+    """
+    cdef ColumnStatsInput out
+    memset(&out, 0, sizeof(ColumnStatsInput))
+    out.col_index = col_index
+
+    cdef void* schema_ptr = PyCapsule_GetPointer(schema_capsule, "arrow_schema")
+    cdef size_t n = len(array_capsules)
+    cdef size_t i
+    cdef void** chunk_ptrs = <void**>malloc(n * sizeof(void*))
+    if chunk_ptrs == NULL:
+        raise MemoryError()
+
+    cdef cpp_bool ok
+    try:
+        for i in range(n):
+            chunk_ptrs[i] = PyCapsule_GetPointer(array_capsules[i], "arrow_array")
+        with nogil:
+            ok = compute_arrow_column_stats(schema_ptr, chunk_ptrs, n, &out)
+    finally:
+        free(chunk_ptrs)
+
+    if not ok:
+        return None
+
+    if out.type_tag == ord("n"):
+        return (col_index, "null", out.null_count, out.num_rows, 0, 0, 0.0, 0.0, 0, "", "")
+    if out.type_tag == ord("i"):
+        return (col_index, "int", out.null_count, out.num_rows, out.min_int, out.max_int, 0.0, 0.0, 0, "", "")
+    if out.type_tag == ord("f"):
+        return (col_index, "float", out.null_count, out.num_rows, 0, 0, out.min_double, out.max_double, 0, "", "")
+    return None
+
+
+cdef void _fill_stats_inputs(ColumnStatsInput* stats, object stats_data, size_t n, list str_keepalive):
+    """
+    Fill a zeroed ColumnStatsInput array from stats tuples.
+
+    str_keepalive receives the encoded min/max strings; the caller must keep
+    it alive until the C++ call that consumes the array returns.
+    """
+    cdef size_t i
+    for i in range(n):
+        tup = stats_data[i]
+        stats[i].col_index = tup[0]
+
+        type_tag_str = tup[1]
+        if type_tag_str == "int":
+            stats[i].type_tag = ord("i")
+        elif type_tag_str == "float":
+            stats[i].type_tag = ord("f")
+        elif type_tag_str == "str":
+            stats[i].type_tag = ord("s")
+        else:
+            stats[i].type_tag = ord("n")
+
+        stats[i].null_count = tup[2]
+        stats[i].num_rows = tup[3]
+        stats[i].min_int = tup[4]
+        stats[i].max_int = tup[5]
+        stats[i].min_double = tup[6]
+        stats[i].max_double = tup[7]
+        stats[i].max_str_len = tup[8]
+
+        min_str_b = tup[9].encode("utf-8") if tup[9] else b""
+        max_str_b = tup[10].encode("utf-8") if tup[10] else b""
+        str_keepalive.append(min_str_b)
+        str_keepalive.append(max_str_b)
+        stats[i].min_str = min_str_b
+        stats[i].max_str = max_str_b
+
+
 def register_holder_pyx(
     ConnectionImpl conn,
     str name,
@@ -348,6 +614,13 @@ def register_holder_pyx(
     if use_deferred_release:
         release_cb = release_capsule_callback
 
+    # Holders that can split into independent partition streams opt in
+    cdef holder_produce_partitioned_callback_t partitioned_cb = NULL
+    if hasattr(holder, "produce_filtered_partitioned"):
+        partitioned_cb = produce_partitioned_callback
+        # Partition capsules are always released through the deferred queue
+        release_cb = release_capsule_callback
+
     try:
         factory_ptr = register_holder_cpp(
             c_conn,
@@ -357,6 +630,7 @@ def register_holder_pyx(
             n,
             stats,
             produce_callback,
+            partitioned_cb,
             release_cb,
             NULL,  # get_schema_callback unused
             num_columns,
@@ -365,6 +639,8 @@ def register_holder_pyx(
             supports_views,
             c_scan_name,
         )
+        # Charge the factory's metadata footprint to the connection
+        holder_factory_set_accounting(factory_ptr, conn._mem_accounting)
         return <size_t>factory_ptr
     finally:
         if stats != NULL:
@@ -372,6 +648,236 @@ def register_holder_pyx(
         free(c_col_names)
 
 
+def register_holders_batch_pyx(
+    ConnectionImpl conn,
+    list entries,
+    bint replace=True,
+    str scan_name="python_data_scan",
+):
+    """
+    Register several DataHolders in a single catalog transaction.
+
+    Marshals every entry up front, then makes one C++ call that creates all
+    the views inside one transaction - no per-object SQL round-trips. On
+    failure the transaction rolls back, every factory from the batch is
+    destroyed and no holder reference leaks, so the caller can fall back to
+    registering entries one at a time.
+
+    Args:
+        conn: DuckDB connection (ConnectionImpl instance)
+        entries: List of (name, holder, stats_data, supports_views) tuples
+        replace: Whether to replace existing views
+        scan_name: Table function name
+
+    Returns:
+        List of factory pointers, index-aligned with entries
+    """
+    if conn._closed:
+        raise RuntimeError("Connection is closed")
+
+    cdef duckdb_connection c_conn = conn._conn
+    cdef bytes scan_name_bytes = scan_name.encode("utf-8")
+    cdef const char* c_scan_name = scan_name_bytes
+
+    cdef size_t num_regs = len(entries)
+    if num_regs == 0:
+        return []
+
+    cdef HolderRegistration* regs = <HolderRegistration*>malloc(num_regs * sizeof(HolderRegistration))
+    cdef void** out_factories = <void**>malloc(num_regs * sizeof(void*))
+    if regs == NULL or out_factories == NULL:
+        free(regs)
+        free(out_factories)
+        raise MemoryError()
+    memset(regs, 0, num_regs * sizeof(HolderRegistration))
+
+    # Keep every encoded string alive until the C++ call returns
+    cdef list bytes_keepalive = []
+    cdef list holders = []
+
+    cdef size_t r, i, n, num_columns
+    cdef ColumnStatsInput* stats
+    cdef const char** c_col_names
+    cdef int64_t num_rows
+
+    try:
+        for r in range(num_regs):
+            name, holder, stats_data, supports_views = entries[r]
+
+            name_bytes = name.encode("utf-8")
+            bytes_keepalive.append(name_bytes)
+            regs[r].view_name = <const char*>name_bytes
+
+            # Keep holder alive - C++ will store a pointer to it
+            Py_INCREF(holder)
+            holders.append(holder)
+            regs[r].holder_pyobj = <void*><PyObject*>holder
+
+            col_names = holder.column_names
+            num_columns = len(col_names)
+            col_name_bytes = [col_name.encode("utf-8") for col_name in col_names]
+            bytes_keepalive.append(col_name_bytes)
+            c_col_names = <const char**>malloc(num_columns * sizeof(const char*))
+            if c_col_names == NULL:
+                raise MemoryError()
+            for i in range(num_columns):
+                c_col_names[i] = <const char*>(<bytes>col_name_bytes[i])
+            regs[r].num_columns = num_columns
+            regs[r].column_names = c_col_names
+
+            num_rows = -1
+            if holder.num_rows is not None:
+                num_rows = holder.num_rows
+            regs[r].num_rows = num_rows
+
+            if stats_data is not None and len(stats_data) > 0:
+                n = len(stats_data)
+                stats = <ColumnStatsInput*>malloc(n * sizeof(ColumnStatsInput))
+                if stats == NULL:
+                    raise MemoryError()
+                memset(stats, 0, n * sizeof(ColumnStatsInput))
+                _fill_stats_inputs(stats, stats_data, n, bytes_keepalive)
+                regs[r].stats_count = n
+                regs[r].stats = stats
+
+            regs[r].supports_views = supports_views
+            regs[r].use_partitioned = hasattr(holder, "produce_filtered_partitioned")
+            regs[r].use_deferred_release = False
+
+        register_holders_batch_cpp(
+            c_conn,
+            regs,
+            num_regs,
+            produce_callback,
+            produce_partitioned_callback,
+            release_capsule_callback,
+            replace,
+            c_scan_name,
+            out_factories,
+        )
+
+        # Charge each factory's metadata footprint to the connection
+        for r in range(num_regs):
+            holder_factory_set_accounting(out_factories[r], conn._mem_accounting)
+
+        return [<size_t>out_factories[r] for r in range(num_regs)]
+    except Exception:
+        # C++ destroyed any factories it built; drop our holder references
+        for holder in holders:
+            Py_DECREF(holder)
+        raise
+    finally:
+        for r in range(num_regs):
+            if regs[r].stats != NULL:
+                free(<void*>regs[r].stats)
+            if regs[r].column_names != NULL:
+                free(<void*>regs[r].column_names)
+        free(regs)
+        free(out_factories)
+
+
+def add_preexported_stream_pyx(size_t factory_ptr, object stream_capsule):
+    """
+    Hand the factory a ready full-table ArrowArrayStream.
+
+    Projection/filter-free scans consume these directly in C++ without
+    acquiring the GIL on DuckDB's scan threads. Each stream serves exactly
+    one scan; the capsule reference is held by the factory until it is
+    destroyed or the holder is swapped out.
+
+    Args:
+        factory_ptr: Pointer returned by register_holder_pyx
+        stream_capsule: "arrow_array_stream" PyCapsule over the full table
+    """
+    cdef void* stream_ptr = PyCapsule_GetPointer(stream_capsule, "arrow_array_stream")
+    Py_INCREF(stream_capsule)
+    if not add_preexported_stream_cpp(<void*>factory_ptr, stream_ptr, <void*><PyObject*>stream_capsule):
+        Py_DECREF(stream_capsule)
+        raise RuntimeError("Failed to attach pre-exported stream to holder factory")
+
+
+def update_holder_pyx(size_t factory_ptr, object holder, object stats_data):
+    """
+    Swap the data behind an existing registration in place.
+
+    The view and HolderFactory survive - only the holder pointer, row count
+    and precomputed statistics change - so refreshing a growing table skips
+    catalog churn and the schema re-fetch. The new holder must expose the
+    same column schema as the one it replaces (the caller checks this).
+
+    Args:
+        factory_ptr: Pointer returned by register_holder_pyx
+        holder: Replacement DataHolder instance
+        stats_data: List of statistics tuples, or None
+    """
+    cdef int64_t num_rows = -1
+    if holder.num_rows is not None:
+        num_rows = holder.num_rows
+
+    # Convert stats to struct array (same layout as register_holder_pyx)
+    cdef size_t n = 0
+    cdef size_t i
+    cdef ColumnStatsInput* stats = NULL
+    cdef list min_str_bytes_list = []
+    cdef list max_str_bytes_list = []
+
+    if stats_data is not None and len(stats_data) > 0:
+        n = len(stats_data)
+        stats = <ColumnStatsInput*>malloc(n * sizeof(ColumnStatsInput))
+        memset(stats, 0, n * sizeof(ColumnStatsInput))
+
+        for i in range(n):
+            tup = stats_data[i]
+            stats[i].col_index = tup[0]
+
+            type_tag_str = tup[1]
+            if type_tag_str == "int":
+                stats[i].type_tag = ord("i")
+            elif type_tag_str == "float":
+                stats[i].type_tag = ord("f")
+            elif type_tag_str == "str":
+                stats[i].type_tag = ord("s")
+            else:
+                stats[i].type_tag = ord("n")
+
+            stats[i].null_count = tup[2]
+            stats[i].num_rows = tup[3]
+            stats[i].min_int = tup[4]
+            stats[i].max_int = tup[5]
+            stats[i].min_double = tup[6]
+            stats[i].max_double = tup[7]
+            stats[i].max_str_len = tup[8]
+
+            min_str_b = tup[9].encode("utf-8") if tup[9] else b""
+            max_str_b = tup[10].encode("utf-8") if tup[10] else b""
+            min_str_bytes_list.append(min_str_b)
+            max_str_bytes_list.append(max_str_b)
+            stats[i].min_str = min_str_b
+            stats[i].max_str = max_str_b
+
+    # Keep the new holder alive for the C++ pointer; drop the old reference
+    # once the swap has happened
+    Py_INCREF(holder)
+    cdef void* old_holder = NULL
+    try:
+        old_holder = update_holder_cpp(
+            <void*>factory_ptr,
+            <void*><PyObject*>holder,
+            num_rows,
+            n,
+            stats,
+        )
+    finally:
+        if stats != NULL:
+            free(stats)
+
+    if old_holder == NULL:
+        Py_DECREF(holder)
+        raise RuntimeError("update_holder failed: invalid factory or holder")
+
+    Py_DECREF(<object>old_holder)
+
+
 def delete_holder_factory_pyx(object conn, size_t factory_ptr, object holder=None):
     """
     Delete a factory and release the holder reference.
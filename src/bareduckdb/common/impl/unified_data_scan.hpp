@@ -1,11 +1,14 @@
 #pragma once
 
 #include <Python.h>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <memory>
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <vector>
-#include <deque>
 
 #include "duckdb.hpp"
 #include "duckdb/main/connection.hpp"
@@ -13,7 +16,12 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/function/table/arrow.hpp"
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/catalog/catalog.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_view_info.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
@@ -22,7 +30,13 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/statistics/string_stats.hpp"
@@ -47,41 +61,104 @@ using duckdb::unique_ptr;
 using duckdb::Value;
 using duckdb::vector;
 
+// Bump allocator backing filter conversion. Pushdown with large IN-lists
+// (10k+ values) previously turned every entry into its own deque node
+// allocation; here each request bumps a pointer inside a slab, arrays come
+// out contiguous, and slabs are retained across Reset() so a steady-state
+// Produce call does no heap allocation for filter conversion at all.
+// Pointers stay valid until the next Reset().
+class FilterArena {
+public:
+    static constexpr size_t SLAB_BYTES = 16 * 1024;
+
+    void* Allocate(size_t bytes, size_t alignment) {
+        for (;;) {
+            if (current < slabs.size()) {
+                size_t offset = (used + alignment - 1) & ~(alignment - 1);
+                if (offset + bytes <= slab_sizes[current]) {
+                    void* ptr = slabs[current].get() + offset;
+                    used = offset + bytes;
+                    std::memset(ptr, 0, bytes);
+                    return ptr;
+                }
+                current++;
+                used = 0;
+                continue;
+            }
+            // Oversized requests (large IN-lists) get a dedicated slab so the
+            // returned array is still one contiguous block
+            size_t capacity = bytes > SLAB_BYTES ? bytes : SLAB_BYTES;
+            slabs.emplace_back(new char[capacity]);
+            slab_sizes.push_back(capacity);
+        }
+    }
+
+    void Reset() {
+        current = 0;
+        used = 0;
+    }
+
+private:
+    std::vector<std::unique_ptr<char[]>> slabs;
+    std::vector<size_t> slab_sizes;
+    size_t current = 0;
+    size_t used = 0;
+};
+
 class FilterBuilder {
 public:
-    std::deque<HolderFilterInfo> filters;
-    std::deque<HolderFilterInfo> child_arrays_storage;
-    std::deque<HolderFilterValue> value_arrays_storage;
-    std::deque<std::string> strings;
+    explicit FilterBuilder(FilterArena& arena_in) : arena(arena_in) {}
 
     HolderFilterInfo* allocate() {
-        filters.push_back({});
-        std::memset(&filters.back(), 0, sizeof(HolderFilterInfo));
-        return &filters.back();
+        return static_cast<HolderFilterInfo*>(
+            arena.Allocate(sizeof(HolderFilterInfo), alignof(HolderFilterInfo)));
     }
 
     HolderFilterInfo* allocate_children(size_t n) {
-        size_t start = child_arrays_storage.size();
-        for (size_t i = 0; i < n; i++) {
-            child_arrays_storage.push_back({});
-            std::memset(&child_arrays_storage.back(), 0, sizeof(HolderFilterInfo));
-        }
-        return &child_arrays_storage[start];
+        return static_cast<HolderFilterInfo*>(
+            arena.Allocate(n * sizeof(HolderFilterInfo), alignof(HolderFilterInfo)));
     }
 
     HolderFilterValue* allocate_values(size_t n) {
-        size_t start = value_arrays_storage.size();
-        for (size_t i = 0; i < n; i++) {
-            value_arrays_storage.push_back({});
-            std::memset(&value_arrays_storage.back(), 0, sizeof(HolderFilterValue));
-        }
-        return &value_arrays_storage[start];
+        // One contiguous block - the Cython side walks IN-lists linearly
+        return static_cast<HolderFilterValue*>(
+            arena.Allocate(n * sizeof(HolderFilterValue), alignof(HolderFilterValue)));
+    }
+
+    HolderFilterExpr* allocate_expr() {
+        return static_cast<HolderFilterExpr*>(
+            arena.Allocate(sizeof(HolderFilterExpr), alignof(HolderFilterExpr)));
+    }
+
+    HolderFilterExpr* allocate_expr_children(size_t n) {
+        return static_cast<HolderFilterExpr*>(
+            arena.Allocate(n * sizeof(HolderFilterExpr), alignof(HolderFilterExpr)));
     }
 
     const char* store_string(const std::string& s) {
-        strings.push_back(s);
-        return strings.back().c_str();
+        char* buf = static_cast<char*>(arena.Allocate(s.size() + 1, 1));
+        std::memcpy(buf, s.c_str(), s.size() + 1);
+        return buf;
+    }
+
+    int64_t* allocate_int64_buffer(size_t n) {
+        return static_cast<int64_t*>(arena.Allocate(n * sizeof(int64_t), alignof(int64_t)));
+    }
+
+    double* allocate_double_buffer(size_t n) {
+        return static_cast<double*>(arena.Allocate(n * sizeof(double), alignof(double)));
+    }
+
+    int32_t* allocate_int32_buffer(size_t n) {
+        return static_cast<int32_t*>(arena.Allocate(n * sizeof(int32_t), alignof(int32_t)));
     }
+
+    char* allocate_bytes(size_t n) {
+        return static_cast<char*>(arena.Allocate(n, 1));
+    }
+
+private:
+    FilterArena& arena;
 };
 
 inline HolderFilterValue ConvertValue(const Value& val, FilterBuilder& builder) {
@@ -138,6 +215,210 @@ inline HolderFilterValue ConvertValue(const Value& val, FilterBuilder& builder)
     return info;
 }
 
+// IN-lists at least this large and homogeneous are also delivered as one
+// contiguous typed buffer, so the Cython layer can hand the holder a single
+// array instead of marshalling one Python object per element
+constexpr size_t IN_BUFFER_MIN_VALUES = 64;
+
+inline void PackInListBuffer(HolderFilterInfo& info, FilterBuilder& builder) {
+    if (info.num_values < IN_BUFFER_MIN_VALUES || !info.in_values) {
+        return;
+    }
+    int kind = info.in_values[0].value_type;
+    if (kind != 2 && kind != 3 && kind != 4) {
+        return;
+    }
+    for (size_t i = 1; i < info.num_values; i++) {
+        if (info.in_values[i].value_type != kind) {
+            return;
+        }
+    }
+
+    if (kind == 2) {
+        int64_t* buf = builder.allocate_int64_buffer(info.num_values);
+        for (size_t i = 0; i < info.num_values; i++) {
+            buf[i] = info.in_values[i].int_val;
+        }
+        info.in_int_buffer = buf;
+    } else if (kind == 3) {
+        double* buf = builder.allocate_double_buffer(info.num_values);
+        for (size_t i = 0; i < info.num_values; i++) {
+            buf[i] = info.in_values[i].float_val;
+        }
+        info.in_float_buffer = buf;
+    } else {
+        // Offset-packed UTF-8: num_values + 1 int32 offsets into one blob
+        size_t total = 0;
+        for (size_t i = 0; i < info.num_values; i++) {
+            total += std::strlen(info.in_values[i].str_val);
+        }
+        if (total > static_cast<size_t>(INT32_MAX)) {
+            return;
+        }
+        int32_t* offsets = builder.allocate_int32_buffer(info.num_values + 1);
+        char* data = builder.allocate_bytes(total);
+        size_t pos = 0;
+        for (size_t i = 0; i < info.num_values; i++) {
+            offsets[i] = static_cast<int32_t>(pos);
+            size_t len = std::strlen(info.in_values[i].str_val);
+            std::memcpy(data + pos, info.in_values[i].str_val, len);
+            pos += len;
+        }
+        offsets[info.num_values] = static_cast<int32_t>(pos);
+        info.in_str_buffer = data;
+        info.in_str_offsets = offsets;
+    }
+    info.in_buffer_kind = kind;
+}
+
+// Converts the Expression inside an EXPRESSION_FILTER into the small
+// HolderFilterExpr vocabulary. Inside an expression filter the scanned
+// column appears as a BoundReferenceExpression, so any reference node maps
+// to HOLDER_EXPR_COLUMN. Returns nullptr for anything outside the
+// vocabulary - the holder then treats the whole filter as pass-through and
+// DuckDB's own filtering keeps the result correct.
+inline HolderFilterExpr* ConvertExpression(const duckdb::Expression& expr, FilterBuilder& builder) {
+    switch (expr.GetExpressionClass()) {
+        case duckdb::ExpressionClass::BOUND_REF:
+            {
+                HolderFilterExpr* node = builder.allocate_expr();
+                node->expr_op = HOLDER_EXPR_COLUMN;
+                return node;
+            }
+
+        case duckdb::ExpressionClass::BOUND_CONSTANT: {
+            auto& const_expr = expr.Cast<duckdb::BoundConstantExpression>();
+            HolderFilterExpr* node = builder.allocate_expr();
+            node->expr_op = HOLDER_EXPR_CONST;
+            node->value = ConvertValue(const_expr.value, builder);
+            if (node->value.value_type == 0 && !const_expr.value.IsNull()) {
+                // Constant of a type ConvertValue can't represent
+                return nullptr;
+            }
+            return node;
+        }
+
+        case duckdb::ExpressionClass::BOUND_COMPARISON: {
+            auto& cmp = expr.Cast<duckdb::BoundComparisonExpression>();
+            HolderFilterExpr* left = ConvertExpression(*cmp.left, builder);
+            HolderFilterExpr* right = ConvertExpression(*cmp.right, builder);
+            if (!left || !right) {
+                return nullptr;
+            }
+            HolderFilterExpr* node = builder.allocate_expr();
+            node->expr_op = HOLDER_EXPR_COMPARE;
+            node->comparison_type = static_cast<int>(expr.GetExpressionType());
+            node->num_children = 2;
+            node->children = builder.allocate_expr_children(2);
+            node->children[0] = *left;
+            node->children[1] = *right;
+            return node;
+        }
+
+        case duckdb::ExpressionClass::BOUND_CONJUNCTION: {
+            auto& conj = expr.Cast<duckdb::BoundConjunctionExpression>();
+            HolderFilterExpr* node = builder.allocate_expr();
+            node->expr_op = expr.GetExpressionType() == ExpressionType::CONJUNCTION_AND
+                                ? HOLDER_EXPR_AND
+                                : HOLDER_EXPR_OR;
+            node->num_children = conj.children.size();
+            node->children = builder.allocate_expr_children(node->num_children);
+            for (size_t i = 0; i < node->num_children; i++) {
+                HolderFilterExpr* child = ConvertExpression(*conj.children[i], builder);
+                if (!child) {
+                    return nullptr;
+                }
+                node->children[i] = *child;
+            }
+            return node;
+        }
+
+        case duckdb::ExpressionClass::BOUND_FUNCTION: {
+            auto& func = expr.Cast<duckdb::BoundFunctionExpression>();
+            const auto& name = func.function.name;
+
+            // Arithmetic: operand order is preserved
+            int op = 0;
+            if (name == "+") {
+                op = HOLDER_EXPR_ADD;
+            } else if (name == "-") {
+                op = HOLDER_EXPR_SUB;
+            } else if (name == "*") {
+                op = HOLDER_EXPR_MUL;
+            }
+            if (op != 0 && func.children.size() == 2) {
+                HolderFilterExpr* left = ConvertExpression(*func.children[0], builder);
+                HolderFilterExpr* right = ConvertExpression(*func.children[1], builder);
+                if (!left || !right) {
+                    return nullptr;
+                }
+                HolderFilterExpr* node = builder.allocate_expr();
+                node->expr_op = op;
+                node->num_children = 2;
+                node->children = builder.allocate_expr_children(2);
+                node->children[0] = *left;
+                node->children[1] = *right;
+                return node;
+            }
+
+            // String prefix/suffix/contains with a constant pattern (how the
+            // optimizer rewrites anchored LIKEs)
+            if (name == "prefix") {
+                op = HOLDER_EXPR_PREFIX;
+            } else if (name == "suffix") {
+                op = HOLDER_EXPR_SUFFIX;
+            } else if (name == "contains") {
+                op = HOLDER_EXPR_CONTAINS;
+            } else {
+                op = 0;
+            }
+            if (op != 0 && func.children.size() == 2 &&
+                func.children[1]->GetExpressionClass() == duckdb::ExpressionClass::BOUND_CONSTANT) {
+                auto& pattern = func.children[1]->Cast<duckdb::BoundConstantExpression>();
+                if (pattern.value.IsNull() || pattern.value.type().id() != LogicalTypeId::VARCHAR) {
+                    return nullptr;
+                }
+                HolderFilterExpr* child = ConvertExpression(*func.children[0], builder);
+                if (!child) {
+                    return nullptr;
+                }
+                HolderFilterExpr* node = builder.allocate_expr();
+                node->expr_op = op;
+                node->aux = builder.store_string(pattern.value.GetValue<std::string>());
+                node->num_children = 1;
+                node->children = builder.allocate_expr_children(1);
+                node->children[0] = *child;
+                return node;
+            }
+
+            // date_trunc('part', expr) - the time-bucketing pattern
+            if ((name == "date_trunc" || name == "datetrunc") && func.children.size() == 2 &&
+                func.children[0]->GetExpressionClass() == duckdb::ExpressionClass::BOUND_CONSTANT) {
+                auto& part = func.children[0]->Cast<duckdb::BoundConstantExpression>();
+                if (part.value.IsNull() || part.value.type().id() != LogicalTypeId::VARCHAR) {
+                    return nullptr;
+                }
+                HolderFilterExpr* child = ConvertExpression(*func.children[1], builder);
+                if (!child) {
+                    return nullptr;
+                }
+                HolderFilterExpr* node = builder.allocate_expr();
+                node->expr_op = HOLDER_EXPR_DATE_TRUNC;
+                node->aux = builder.store_string(part.value.GetValue<std::string>());
+                node->num_children = 1;
+                node->children = builder.allocate_expr_children(1);
+                node->children[0] = *child;
+                return node;
+            }
+
+            return nullptr;
+        }
+
+        default:
+            return nullptr;
+    }
+}
+
 inline HolderFilterInfo* ConvertFilter(const TableFilter* filter, FilterBuilder& builder) {
     HolderFilterInfo* info = builder.allocate();
     info->filter_type = static_cast<int>(filter->filter_type);
@@ -187,6 +468,15 @@ inline HolderFilterInfo* ConvertFilter(const TableFilter* filter, FilterBuilder&
             break;
         }
 
+        case TableFilterType::EXPRESSION_FILTER: {
+            auto* expr_filter = static_cast<const duckdb::ExpressionFilter*>(filter);
+            // nullptr when the expression is outside the vocabulary; the
+            // holder then passes everything through and relies on DuckDB's
+            // own evaluation of the filter
+            info->expr = ConvertExpression(*expr_filter->expr, builder);
+            break;
+        }
+
         case TableFilterType::IN_FILTER: {
             auto* in_filter = static_cast<const duckdb::InFilter*>(filter);
             info->num_values = in_filter->values.size();
@@ -195,6 +485,7 @@ inline HolderFilterInfo* ConvertFilter(const TableFilter* filter, FilterBuilder&
                 for (size_t i = 0; i < info->num_values; i++) {
                     info->in_values[i] = ConvertValue(in_filter->values[i], builder);
                 }
+                PackInListBuffer(*info, builder);
             }
             break;
         }
@@ -206,9 +497,20 @@ inline HolderFilterInfo* ConvertFilter(const TableFilter* filter, FilterBuilder&
     return info;
 }
 
+// Node for HolderFactory's lock-free pending-release stack. Nodes come from
+// a small fixed pool inside the factory (acquired with a per-slot CAS, so
+// there is no ABA window); overflow falls back to heap allocation.
+struct PendingCapsuleNode {
+    void* capsule = nullptr;
+    PendingCapsuleNode* next = nullptr;
+    std::atomic<bool> in_use{false};
+    bool pooled = false;
+};
+
 struct HolderFactory {
     void* holder_ptr;
     holder_produce_callback_t produce_callback;
+    holder_produce_partitioned_callback_t partitioned_produce_callback;
     holder_release_capsule_callback_t release_capsule_callback;
     std::vector<std::string> column_names;
     std::vector<PrecomputedStats> precomputed_stats;
@@ -217,12 +519,34 @@ struct HolderFactory {
     bool supports_views;
 
     void* schema_capsule_pyobj;
-    std::mutex pending_mutex;
-    std::vector<void*> pending_releases;
+
+    // Deferred capsule cleanup. Scan threads enqueue finished capsules with
+    // a single CAS onto a Treiber stack - no mutex, no GIL - and the flush
+    // (update_holder / destruction, both off the scan path) drains the whole
+    // stack under one PyGILState_Ensure.
+    static constexpr size_t PENDING_POOL_SIZE = 64;
+    PendingCapsuleNode pending_pool[PENDING_POOL_SIZE];
+    std::atomic<PendingCapsuleNode*> pending_head{nullptr};
+
+    // Full-table streams handed over at registration. A projection/filter-free
+    // scan takes one of these instead of calling back into Python, so no GIL
+    // is acquired on DuckDB's scan threads. Each stream serves exactly one
+    // scan; the backing capsules stay alive until the factory is destroyed.
+    std::mutex preexport_mutex;
+    std::vector<std::pair<ArrowArrayStream*, void*>> preexported_streams;
+    std::vector<void*> preexport_capsules;
+
+    // Optional per-connection accounting (owned by the connection). Charged
+    // with the factory's own metadata footprint at attach, released in the
+    // destructor; the holder's Arrow buffers stay on the Python side and are
+    // not counted here.
+    ConnectionMemoryAccounting* accounting = nullptr;
+    int64_t accounted_bytes = 0;
 
     HolderFactory(
         void* holder,
         holder_produce_callback_t callback,
+        holder_produce_partitioned_callback_t partitioned_callback,
         holder_release_capsule_callback_t release_callback,
         const std::vector<std::string>& col_names,
         int64_t rows,
@@ -231,6 +555,7 @@ struct HolderFactory {
         bool supports_views_)
         : holder_ptr(holder)
         , produce_callback(callback)
+        , partitioned_produce_callback(partitioned_callback)
         , release_capsule_callback(release_callback)
         , column_names(col_names)
         , num_rows(rows)
@@ -240,31 +565,110 @@ struct HolderFactory {
         ParseStats(stats_count, stats);
     }
 
+    void AttachAccounting(ConnectionMemoryAccounting* acc) {
+        if (!acc || accounting) {
+            return;
+        }
+        int64_t bytes = static_cast<int64_t>(sizeof(HolderFactory));
+        for (const auto& name : column_names) {
+            bytes += static_cast<int64_t>(name.size());
+        }
+        for (const auto& ps : precomputed_stats) {
+            bytes += static_cast<int64_t>(sizeof(ps) + ps.min_str.size() + ps.max_str.size());
+        }
+        acc->Add(acc->holder_bytes, bytes);
+        accounting = accounting_retain(acc);
+        accounted_bytes = bytes;
+    }
+
     ~HolderFactory() {
-        if (schema_capsule_pyobj) {
+        if (accounting) {
+            if (accounted_bytes > 0) {
+                accounting->Sub(accounting->holder_bytes, accounted_bytes);
+            }
+            accounting_release(accounting);
+        }
+        if (schema_capsule_pyobj || !preexport_capsules.empty()) {
             PyGILState_STATE gstate = PyGILState_Ensure();
-            Py_DECREF(reinterpret_cast<PyObject*>(schema_capsule_pyobj));
+            if (schema_capsule_pyobj) {
+                Py_DECREF(reinterpret_cast<PyObject*>(schema_capsule_pyobj));
+            }
+            // Dropping an unconsumed capsule releases its stream; consumed
+            // streams were moved out and their release already nulled
+            for (void* capsule : preexport_capsules) {
+                Py_DECREF(reinterpret_cast<PyObject*>(capsule));
+            }
             PyGILState_Release(gstate);
         }
         FlushPendingReleases();
     }
 
+    void AddPreexportedStream(ArrowArrayStream* stream, void* capsule_pyobj) {
+        std::lock_guard<std::mutex> lock(preexport_mutex);
+        preexported_streams.emplace_back(stream, capsule_pyobj);
+        preexport_capsules.push_back(capsule_pyobj);
+    }
+
+    ArrowArrayStream* TakePreexportedStream() {
+        std::lock_guard<std::mutex> lock(preexport_mutex);
+        if (preexported_streams.empty()) {
+            return nullptr;
+        }
+        ArrowArrayStream* stream = preexported_streams.back().first;
+        preexported_streams.pop_back();
+        return stream;
+    }
+
+    // Called from DuckDB scan threads without the GIL: one pool-slot CAS to
+    // grab a node plus one CAS to push it. Never blocks, never allocates
+    // unless more than PENDING_POOL_SIZE releases are in flight at once.
     void QueueCapsuleRelease(void* capsule) {
-        std::lock_guard<std::mutex> lock(pending_mutex);
-        pending_releases.push_back(capsule);
+        PendingCapsuleNode* node = nullptr;
+        for (size_t i = 0; i < PENDING_POOL_SIZE; i++) {
+            bool expected = false;
+            if (pending_pool[i].in_use.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                node = &pending_pool[i];
+                node->pooled = true;
+                break;
+            }
+        }
+        if (!node) {
+            node = new PendingCapsuleNode();
+        }
+        node->capsule = capsule;
+        node->next = pending_head.load(std::memory_order_relaxed);
+        while (!pending_head.compare_exchange_weak(
+                node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
     }
 
+    // Single-consumer drain: detach the whole stack with one exchange, then
+    // release every capsule under a single PyGILState_Ensure. Capsule
+    // release is a plain Py_DECREF (what release_capsule_callback does one
+    // GIL acquisition at a time), so it is done natively here - the
+    // callback pointer stays the "deferred release enabled" flag.
     void FlushPendingReleases() {
-        std::vector<void*> to_release;
-        {
-            std::lock_guard<std::mutex> lock(pending_mutex);
-            to_release.swap(pending_releases);
+        PendingCapsuleNode* head = pending_head.exchange(nullptr, std::memory_order_acquire);
+        if (!head) {
+            return;
         }
-        for (void* capsule : to_release) {
-            if (capsule && release_capsule_callback) {
-                release_capsule_callback(capsule);
+        PyGILState_STATE gstate = PyGILState_Ensure();
+        while (head) {
+            PendingCapsuleNode* next = head->next;
+            if (head->capsule) {
+                Py_DECREF(reinterpret_cast<PyObject*>(head->capsule));
+            }
+            if (head->pooled) {
+                head->capsule = nullptr;
+                head->next = nullptr;
+                head->in_use.store(false, std::memory_order_release);
+            } else {
+                delete head;
             }
+            head = next;
         }
+        PyGILState_Release(gstate);
     }
 
     void ParseStats(size_t stats_count, const ColumnStatsInput* stats) {
@@ -356,62 +760,773 @@ struct HolderFactory {
 
     static unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(
         uintptr_t factory_ptr,
-        ArrowStreamParameters& params)
-    {
-        auto* factory = reinterpret_cast<HolderFactory*>(factory_ptr);
+        ArrowStreamParameters& params);
+};
+
+// Concatenates N partition streams produced independently by the holder.
+// DuckDB's arrow scan consumes a single stream handle, so partitions are
+// stitched together at the C boundary; the holder avoids concatenating
+// partitions (row groups, frame slices) into one Python-side stream.
+struct PartitionedArrowStreamWrapper {
+    HolderFactory* factory;
+    std::vector<ArrowArrayStream> streams;
+    std::vector<void*> capsules;
+    size_t current = 0;
+    std::mutex mutex;
+    std::string last_error;
+
+    // Captured from partition 0 at construction, before any consumption:
+    // the C ABI allows get_schema at any point, but GetNext releases each
+    // partition as soon as it is exhausted, so re-querying partition 0
+    // later would call into a released stream. Immutable afterwards, so
+    // GetSchema needs no lock.
+    ArrowSchemaWrapper cached_schema;
+
+    void FinishStream(size_t idx) {
+        if (streams[idx].release) {
+            streams[idx].release(&streams[idx]);
+        }
+        if (capsules[idx] && factory->release_capsule_callback) {
+            factory->QueueCapsuleRelease(capsules[idx]);
+            capsules[idx] = nullptr;
+        }
+    }
+
+    static int GetSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+        if (!stream || !out) {
+            return -1;
+        }
+        auto* wrapper = reinterpret_cast<PartitionedArrowStreamWrapper*>(stream->private_data);
+        if (!wrapper || !wrapper->cached_schema.arrow_schema.release) {
+            return -1;
+        }
+        // Borrowed export, same as HolderFactory::GetSchema: the wrapper
+        // keeps ownership, so the caller must not release it
+        *out = wrapper->cached_schema.arrow_schema;
+        out->release = nullptr;
+        return 0;
+    }
+
+    static int GetNext(ArrowArrayStream* stream, ArrowArray* out) {
+        if (!stream || !out) {
+            return -1;
+        }
+        auto* wrapper = reinterpret_cast<PartitionedArrowStreamWrapper*>(stream->private_data);
+        if (!wrapper) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->mutex);
+
+        while (wrapper->current < wrapper->streams.size()) {
+            ArrowArrayStream& part = wrapper->streams[wrapper->current];
+            int rc = part.get_next(&part, out);
+            if (rc != 0) {
+                const char* err = part.get_last_error ? part.get_last_error(&part) : nullptr;
+                wrapper->last_error = err ? err : "Unknown error in partition stream";
+                return rc;
+            }
+            if (out->release != nullptr) {
+                return 0;
+            }
+            // Partition exhausted - release it and move to the next one
+            wrapper->FinishStream(wrapper->current);
+            wrapper->current++;
+        }
+
+        // All partitions exhausted
+        out->release = nullptr;
+        return 0;
+    }
+
+    static void Release(ArrowArrayStream* stream) {
+        if (!stream || !stream->release) {
+            return;
+        }
+        stream->release = nullptr;
+        auto* wrapper = reinterpret_cast<PartitionedArrowStreamWrapper*>(stream->private_data);
+        if (wrapper) {
+            for (size_t i = wrapper->current; i < wrapper->streams.size(); i++) {
+                wrapper->FinishStream(i);
+            }
+            delete wrapper;
+        }
+    }
+
+    static const char* GetLastError(ArrowArrayStream* stream) {
+        if (!stream) {
+            return nullptr;
+        }
+        auto* wrapper = reinterpret_cast<PartitionedArrowStreamWrapper*>(stream->private_data);
+        if (!wrapper || wrapper->last_error.empty()) {
+            return nullptr;
+        }
+        return wrapper->last_error.c_str();
+    }
+};
+
+// Native filter evaluation over produced batches.
+//
+// Holders are allowed to skip pushed-down filters they cannot translate
+// (ArrowHolder silently drops unsupported predicates) because DuckDB
+// re-evaluates every pushed filter on the returned chunks. That safety net
+// means full batches flow across the boundary whenever the holder declines a
+// predicate. This stage re-checks the converted filters directly against the
+// Arrow buffers and drops whole batches where no row can possibly match,
+// so declined-pushdown columns still get early elimination at the scan
+// boundary. It is strictly conservative: a batch is only dropped when some
+// single predicate provably matches zero rows; anything the evaluator does
+// not understand passes through untouched for DuckDB to re-check.
+struct BatchPredicate {
+    size_t child_idx;     // position of the column within produced batches
+    int filter_type;      // CONSTANT_COMPARISON / IS_NULL / IS_NOT_NULL
+    int comparison_type;  // duckdb::ExpressionType, comparisons only
+    int value_type;       // mirrors HolderFilterValue: 1 bool, 2 int, 3 float, 4 str
+    bool bool_val;
+    int64_t int_val;
+    double float_val;
+    std::string str_val;
+    char column_kind;     // 'i' signed int, 'u' unsigned, 'f' float, 'b' bool, 's' utf8, 'v' string_view
+    int byte_width;       // numeric width in bytes
+    bool large_offsets;   // large_utf8
+};
+
+// Maps an Arrow format string to an evaluable column kind; returns false for
+// anything the evaluator does not handle (nested, decimal, non-micro
+// timestamps, ...).
+inline bool BatchFilterColumnKind(const char* fmt, char& kind, int& width, bool& large_offsets) {
+    if (!fmt) return false;
+    large_offsets = false;
+    std::string f(fmt);
+    if (f == "b") { kind = 'b'; width = 0; return true; }
+    if (f == "c") { kind = 'i'; width = 1; return true; }
+    if (f == "s") { kind = 'i'; width = 2; return true; }
+    if (f == "i") { kind = 'i'; width = 4; return true; }
+    if (f == "l") { kind = 'i'; width = 8; return true; }
+    if (f == "C") { kind = 'u'; width = 1; return true; }
+    if (f == "S") { kind = 'u'; width = 2; return true; }
+    if (f == "I") { kind = 'u'; width = 4; return true; }
+    if (f == "L") { kind = 'u'; width = 8; return true; }
+    if (f == "f") { kind = 'f'; width = 4; return true; }
+    if (f == "g") { kind = 'f'; width = 8; return true; }
+    if (f == "u") { kind = 's'; width = 0; return true; }
+    if (f == "U") { kind = 's'; width = 0; large_offsets = true; return true; }
+    if (f == "vu") { kind = 'v'; width = 0; return true; }
+    // DATE and TIMESTAMP constants are converted to days / micros by
+    // ConvertValue, so only the matching physical encodings are comparable
+    if (f == "tdD") { kind = 'i'; width = 4; return true; }
+    if (f.compare(0, 4, "tsu:") == 0) { kind = 'i'; width = 8; return true; }
+    return false;
+}
+
+inline bool BatchRowIsValid(const ArrowArray* col, int64_t row) {
+    if (col->null_count == 0 || col->n_buffers < 1 || !col->buffers[0]) {
+        return true;
+    }
+    const uint8_t* validity = reinterpret_cast<const uint8_t*>(col->buffers[0]);
+    int64_t idx = col->offset + row;
+    return (validity[idx >> 3] >> (idx & 7)) & 1;
+}
+
+inline int64_t BatchReadInt(const ArrowArray* col, int64_t row, int width, bool is_unsigned) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(col->buffers[1]);
+    int64_t idx = col->offset + row;
+    switch (width) {
+        case 1: return is_unsigned ? static_cast<int64_t>(data[idx])
+                                   : static_cast<int64_t>(reinterpret_cast<const int8_t*>(data)[idx]);
+        case 2: return is_unsigned ? static_cast<int64_t>(reinterpret_cast<const uint16_t*>(data)[idx])
+                                   : static_cast<int64_t>(reinterpret_cast<const int16_t*>(data)[idx]);
+        case 4: return is_unsigned ? static_cast<int64_t>(reinterpret_cast<const uint32_t*>(data)[idx])
+                                   : static_cast<int64_t>(reinterpret_cast<const int32_t*>(data)[idx]);
+        default: return reinterpret_cast<const int64_t*>(data)[idx];
+    }
+}
+
+inline double BatchReadFloat(const ArrowArray* col, int64_t row, int width) {
+    int64_t idx = col->offset + row;
+    if (width == 4) {
+        return static_cast<double>(reinterpret_cast<const float*>(col->buffers[1])[idx]);
+    }
+    return reinterpret_cast<const double*>(col->buffers[1])[idx];
+}
+
+inline bool BatchReadString(const ArrowArray* col, int64_t row, char kind, bool large_offsets,
+                            const char*& out_ptr, int64_t& out_len) {
+    int64_t idx = col->offset + row;
+    if (kind == 's') {
+        if (col->n_buffers < 3 || !col->buffers[1] || !col->buffers[2]) return false;
+        const char* data = reinterpret_cast<const char*>(col->buffers[2]);
+        if (large_offsets) {
+            const int64_t* offsets = reinterpret_cast<const int64_t*>(col->buffers[1]);
+            out_ptr = data + offsets[idx];
+            out_len = offsets[idx + 1] - offsets[idx];
+        } else {
+            const int32_t* offsets = reinterpret_cast<const int32_t*>(col->buffers[1]);
+            out_ptr = data + offsets[idx];
+            out_len = offsets[idx + 1] - offsets[idx];
+        }
+        return true;
+    }
+    // string_view: 16-byte views; short strings inline, long strings point
+    // into one of the variadic data buffers (buffers[2..n_buffers-2])
+    if (col->n_buffers < 2 || !col->buffers[1]) return false;
+    const uint8_t* view = reinterpret_cast<const uint8_t*>(col->buffers[1]) + idx * 16;
+    int32_t len;
+    std::memcpy(&len, view, sizeof(int32_t));
+    out_len = len;
+    if (len <= 12) {
+        out_ptr = reinterpret_cast<const char*>(view + 4);
+        return true;
+    }
+    int32_t buf_idx, buf_offset;
+    std::memcpy(&buf_idx, view + 8, sizeof(int32_t));
+    std::memcpy(&buf_offset, view + 12, sizeof(int32_t));
+    if (2 + buf_idx >= col->n_buffers || !col->buffers[2 + buf_idx]) return false;
+    out_ptr = reinterpret_cast<const char*>(col->buffers[2 + buf_idx]) + buf_offset;
+    return true;
+}
+
+template <typename T>
+inline bool BatchCompare(const T& lhs, const T& rhs, int comparison_type) {
+    switch (static_cast<ExpressionType>(comparison_type)) {
+        case ExpressionType::COMPARE_EQUAL: return lhs == rhs;
+        case ExpressionType::COMPARE_NOTEQUAL: return lhs != rhs;
+        case ExpressionType::COMPARE_LESSTHAN: return lhs < rhs;
+        case ExpressionType::COMPARE_GREATERTHAN: return lhs > rhs;
+        case ExpressionType::COMPARE_LESSTHANOREQUALTO: return lhs <= rhs;
+        case ExpressionType::COMPARE_GREATERTHANOREQUALTO: return lhs >= rhs;
+        default: return true;  // conservative: unknown comparison always "matches"
+    }
+}
+
+inline int BatchCompareStrings(const char* a, int64_t a_len, const char* b, int64_t b_len) {
+    int64_t min_len = a_len < b_len ? a_len : b_len;
+    int cmp = min_len > 0 ? std::memcmp(a, b, static_cast<size_t>(min_len)) : 0;
+    if (cmp != 0) return cmp;
+    return a_len < b_len ? -1 : (a_len > b_len ? 1 : 0);
+}
+
+// True if at least one row in the column could satisfy the predicate. Any
+// situation the evaluator cannot decide returns true (pass the batch on).
+inline bool BatchPredicateMatchesAnyRow(const BatchPredicate& p, const ArrowArray* batch) {
+    if (p.child_idx >= static_cast<size_t>(batch->n_children)) return true;
+    const ArrowArray* col = batch->children[p.child_idx];
+    if (!col) return true;
+    int64_t n = col->length;
+    if (n == 0) return false;
+
+    if (p.filter_type == static_cast<int>(TableFilterType::IS_NULL)) {
+        if (col->null_count > 0) return true;
+        if (col->null_count == 0) return false;
+        // null_count unknown - scan the validity bitmap
+        if (col->n_buffers < 1 || !col->buffers[0]) return false;
+        for (int64_t row = 0; row < n; row++) {
+            if (!BatchRowIsValid(col, row)) return true;
+        }
+        return false;
+    }
+
+    if (p.filter_type == static_cast<int>(TableFilterType::IS_NOT_NULL)) {
+        return col->null_count != n;
+    }
+
+    if (p.filter_type != static_cast<int>(TableFilterType::CONSTANT_COMPARISON)) {
+        return true;
+    }
+
+    switch (p.column_kind) {
+        case 'b': {
+            if (p.value_type != 1 || col->n_buffers < 2 || !col->buffers[1]) return true;
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(col->buffers[1]);
+            for (int64_t row = 0; row < n; row++) {
+                if (!BatchRowIsValid(col, row)) continue;
+                int64_t idx = col->offset + row;
+                bool value = (data[idx >> 3] >> (idx & 7)) & 1;
+                if (BatchCompare<bool>(value, p.bool_val, p.comparison_type)) return true;
+            }
+            return false;
+        }
+        case 'i':
+        case 'u': {
+            if (p.value_type != 2 || col->n_buffers < 2 || !col->buffers[1]) return true;
+            for (int64_t row = 0; row < n; row++) {
+                if (!BatchRowIsValid(col, row)) continue;
+                int64_t value = BatchReadInt(col, row, p.byte_width, p.column_kind == 'u');
+                if (BatchCompare<int64_t>(value, p.int_val, p.comparison_type)) return true;
+            }
+            return false;
+        }
+        case 'f': {
+            if (p.value_type != 3 || col->n_buffers < 2 || !col->buffers[1]) return true;
+            for (int64_t row = 0; row < n; row++) {
+                if (!BatchRowIsValid(col, row)) continue;
+                double value = BatchReadFloat(col, row, p.byte_width);
+                if (BatchCompare<double>(value, p.float_val, p.comparison_type)) return true;
+            }
+            return false;
+        }
+        case 's':
+        case 'v': {
+            if (p.value_type != 4) return true;
+            const char* const_ptr = p.str_val.data();
+            int64_t const_len = static_cast<int64_t>(p.str_val.size());
+            for (int64_t row = 0; row < n; row++) {
+                if (!BatchRowIsValid(col, row)) continue;
+                const char* ptr;
+                int64_t len;
+                if (!BatchReadString(col, row, p.column_kind, p.large_offsets, ptr, len)) return true;
+                int cmp = BatchCompareStrings(ptr, len, const_ptr, const_len);
+                if (BatchCompare<int>(cmp, 0, p.comparison_type)) return true;
+            }
+            return false;
+        }
+        default:
+            return true;
+    }
+}
+
+// Interposes on the holder's stream and skips batches where some predicate
+// matches no row at all.
+struct FilteredHolderStreamWrapper {
+    ArrowArrayStream underlying;
+    std::vector<BatchPredicate> predicates;
+    std::string last_error;
+    int64_t batches_dropped = 0;
+
+    static int GetSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+        if (!stream || !out) {
+            return -1;
+        }
+        auto* wrapper = reinterpret_cast<FilteredHolderStreamWrapper*>(stream->private_data);
+        if (!wrapper) {
+            return -1;
+        }
+        return wrapper->underlying.get_schema(&wrapper->underlying, out);
+    }
+
+    static int GetNext(ArrowArrayStream* stream, ArrowArray* out) {
+        if (!stream || !out) {
+            return -1;
+        }
+        auto* wrapper = reinterpret_cast<FilteredHolderStreamWrapper*>(stream->private_data);
+        if (!wrapper) {
+            return -1;
+        }
+
+        for (;;) {
+            int rc = wrapper->underlying.get_next(&wrapper->underlying, out);
+            if (rc != 0) {
+                const char* err = wrapper->underlying.get_last_error
+                    ? wrapper->underlying.get_last_error(&wrapper->underlying) : nullptr;
+                wrapper->last_error = err ? err : "Unknown error in filtered stream";
+                return rc;
+            }
+            if (out->release == nullptr) {
+                return 0;  // end of stream
+            }
+
+            bool drop = false;
+            for (const auto& pred : wrapper->predicates) {
+                if (!BatchPredicateMatchesAnyRow(pred, out)) {
+                    drop = true;
+                    break;
+                }
+            }
+            if (!drop) {
+                return 0;
+            }
+            out->release(out);
+            wrapper->batches_dropped++;
+        }
+    }
+
+    static void Release(ArrowArrayStream* stream) {
+        if (!stream || !stream->release) {
+            return;
+        }
+        stream->release = nullptr;
+        auto* wrapper = reinterpret_cast<FilteredHolderStreamWrapper*>(stream->private_data);
+        if (wrapper) {
+            if (wrapper->underlying.release) {
+                wrapper->underlying.release(&wrapper->underlying);
+            }
+            delete wrapper;
+        }
+    }
+
+    static const char* GetLastError(ArrowArrayStream* stream) {
+        if (!stream) {
+            return nullptr;
+        }
+        auto* wrapper = reinterpret_cast<FilteredHolderStreamWrapper*>(stream->private_data);
+        if (!wrapper || wrapper->last_error.empty()) {
+            return nullptr;
+        }
+        return wrapper->last_error.c_str();
+    }
+};
+
+// Flattens a converted filter into evaluable predicates. CONJUNCTION_AND
+// children each become standalone predicates (each must match at least one
+// row); everything else unsupported is simply not emitted.
+inline void AppendBatchPredicates(const HolderFilterInfo& filter, size_t child_idx,
+                                  char kind, int width, bool large_offsets,
+                                  std::vector<BatchPredicate>& out) {
+    if (filter.filter_type == static_cast<int>(TableFilterType::CONJUNCTION_AND)) {
+        for (size_t i = 0; i < filter.num_children; i++) {
+            AppendBatchPredicates(filter.children[i], child_idx, kind, width, large_offsets, out);
+        }
+        return;
+    }
 
-        HolderProduceParams produce_params = {};
-        std::vector<const char*> col_name_ptrs;
+    if (filter.filter_type != static_cast<int>(TableFilterType::CONSTANT_COMPARISON) &&
+        filter.filter_type != static_cast<int>(TableFilterType::IS_NULL) &&
+        filter.filter_type != static_cast<int>(TableFilterType::IS_NOT_NULL)) {
+        return;
+    }
+
+    BatchPredicate pred = {};
+    pred.child_idx = child_idx;
+    pred.filter_type = filter.filter_type;
+    pred.comparison_type = filter.comparison_type;
+    pred.value_type = filter.value.value_type;
+    pred.bool_val = filter.value.bool_val;
+    pred.int_val = filter.value.int_val;
+    pred.float_val = filter.value.float_val;
+    if (filter.value.value_type == 4) {
+        if (!filter.value.str_val) return;
+        pred.str_val = filter.value.str_val;  // deep copy - FilterBuilder storage dies with Produce
+    }
+    pred.column_kind = kind;
+    pred.byte_width = width;
+    pred.large_offsets = large_offsets;
+    out.push_back(pred);
+}
+
+// Wraps the produced stream with FilteredHolderStreamWrapper when at least
+// one pushed filter is evaluable against the batch schema. No-op otherwise.
+inline void AttachBatchFilterStage(duckdb::ArrowArrayStreamWrapper& wrapper,
+                                   const std::vector<HolderColumnFilter>& filters,
+                                   const std::vector<std::string>& column_names,
+                                   const ArrowStreamParameters& params) {
+    ArrowSchema schema = {};
+    if (wrapper.arrow_array_stream.get_schema(&wrapper.arrow_array_stream, &schema) != 0 ||
+        !schema.release) {
+        return;
+    }
 
+    std::vector<BatchPredicate> predicates;
+    for (const auto& cf : filters) {
+        // Filters carry original column indices; batches carry projected
+        // columns in projection order
+        size_t pos;
         if (!params.projected_columns.columns.empty()) {
-            produce_params.num_projected_cols = params.projected_columns.columns.size();
-            col_name_ptrs.reserve(produce_params.num_projected_cols);
-            for (const auto& col : params.projected_columns.columns) {
-                col_name_ptrs.push_back(col.c_str());
+            if (cf.col_idx >= column_names.size()) continue;
+            const auto& cols = params.projected_columns.columns;
+            auto it = std::find(cols.begin(), cols.end(), column_names[cf.col_idx]);
+            if (it == cols.end()) continue;
+            pos = static_cast<size_t>(std::distance(cols.begin(), it));
+        } else {
+            pos = cf.col_idx;
+        }
+        if (pos >= static_cast<size_t>(schema.n_children) || !schema.children[pos]) continue;
+
+        char kind;
+        int width;
+        bool large_offsets;
+        if (!BatchFilterColumnKind(schema.children[pos]->format, kind, width, large_offsets)) {
+            continue;
+        }
+        AppendBatchPredicates(cf.filter, pos, kind, width, large_offsets, predicates);
+    }
+    schema.release(&schema);
+
+    if (predicates.empty()) {
+        return;
+    }
+
+    auto* filtered = new FilteredHolderStreamWrapper();
+    filtered->underlying = wrapper.arrow_array_stream;
+    filtered->predicates = std::move(predicates);
+    wrapper.arrow_array_stream.private_data = filtered;
+    wrapper.arrow_array_stream.get_schema = FilteredHolderStreamWrapper::GetSchema;
+    wrapper.arrow_array_stream.get_next = FilteredHolderStreamWrapper::GetNext;
+    wrapper.arrow_array_stream.release = FilteredHolderStreamWrapper::Release;
+    wrapper.arrow_array_stream.get_last_error = FilteredHolderStreamWrapper::GetLastError;
+}
+
+// ---------------------------------------------------------------------------
+// Native registration-time statistics
+// ---------------------------------------------------------------------------
+
+inline int64_t CountValidBits(const uint8_t* bitmap, int64_t offset, int64_t length) {
+    int64_t valid = 0;
+    int64_t end = offset + length;
+    int64_t i = offset;
+    // Leading partial byte
+    while (i < end && (i & 7) != 0) {
+        valid += (bitmap[i >> 3] >> (i & 7)) & 1;
+        i++;
+    }
+    // Whole bytes via popcount
+    while (i + 8 <= end) {
+        valid += __builtin_popcount(bitmap[i >> 3]);
+        i += 8;
+    }
+    // Trailing partial byte
+    while (i < end) {
+        valid += (bitmap[i >> 3] >> (i & 7)) & 1;
+        i++;
+    }
+    return valid;
+}
+
+// Fills one ColumnStatsInput by walking raw Arrow buffers: null counts via
+// popcount over the validity bitmap, min/max via a scan of the typed data
+// buffer. Handles flat signed/unsigned ints, floats, date32 and
+// timestamp-us; everything else (strings, bool, nested, uint64 that could
+// exceed int64 range) returns false so the caller keeps the Python-side
+// pass. Returns false on NaN, matching the Python behavior of skipping
+// stats for columns containing NaN. out->col_index must be pre-set; runs
+// without touching Python state so the GIL can be released around it.
+extern "C" bool compute_arrow_column_stats(
+    void* schema_ptr,
+    void** chunk_ptrs,
+    size_t num_chunks,
+    ColumnStatsInput* out)
+{
+    auto* schema = reinterpret_cast<ArrowSchema*>(schema_ptr);
+    if (!schema || !chunk_ptrs || !out) {
+        return false;
+    }
+
+    char kind;
+    int width;
+    bool large_offsets;
+    if (!BatchFilterColumnKind(schema->format, kind, width, large_offsets)) {
+        return false;
+    }
+    if (kind != 'i' && kind != 'u' && kind != 'f') {
+        return false;
+    }
+    if (kind == 'u' && width == 8) {
+        // uint64 values may not fit the int64 stats fields - wrong bounds
+        // would make DuckDB prune rows incorrectly
+        return false;
+    }
+
+    int64_t total_rows = 0;
+    int64_t null_count = 0;
+    bool has_value = false;
+    int64_t min_i = 0, max_i = 0;
+    double min_d = 0.0, max_d = 0.0;
+
+    for (size_t c = 0; c < num_chunks; c++) {
+        const ArrowArray* col = reinterpret_cast<const ArrowArray*>(chunk_ptrs[c]);
+        if (!col) {
+            return false;
+        }
+        total_rows += col->length;
+
+        int64_t chunk_nulls = col->null_count;
+        if (chunk_nulls < 0) {
+            if (col->n_buffers > 0 && col->buffers[0]) {
+                chunk_nulls = col->length - CountValidBits(
+                    reinterpret_cast<const uint8_t*>(col->buffers[0]), col->offset, col->length);
+            } else {
+                chunk_nulls = 0;
             }
-            produce_params.projected_col_names = col_name_ptrs.data();
+        }
+        null_count += chunk_nulls;
+
+        if (chunk_nulls == col->length) {
+            continue;
+        }
+        if (col->n_buffers < 2 || !col->buffers[1]) {
+            return false;
         }
 
-        FilterBuilder builder;
-        std::vector<HolderColumnFilter> filter_infos;
+        const uint8_t* validity =
+            (chunk_nulls > 0 && col->buffers[0]) ? reinterpret_cast<const uint8_t*>(col->buffers[0]) : nullptr;
 
-        if (params.filters && !params.filters->filters.empty()) {
-            for (const auto& [col_idx, filter_ptr] : params.filters->filters) {
-                idx_t original_col_idx;
-                auto it = params.projected_columns.filter_to_col.find(col_idx);
-                if (it != params.projected_columns.filter_to_col.end()) {
-                    original_col_idx = it->second;
-                } else {
-                    original_col_idx = col_idx;
+        for (int64_t row = 0; row < col->length; row++) {
+            if (validity) {
+                int64_t idx = col->offset + row;
+                if (!((validity[idx >> 3] >> (idx & 7)) & 1)) {
+                    continue;
+                }
+            }
+            if (kind == 'f') {
+                double v = BatchReadFloat(col, row, width);
+                if (std::isnan(v)) {
+                    return false;
                 }
+                if (!has_value || v < min_d) min_d = v;
+                if (!has_value || v > max_d) max_d = v;
+            } else {
+                int64_t v = BatchReadInt(col, row, width, kind == 'u');
+                if (!has_value || v < min_i) min_i = v;
+                if (!has_value || v > max_i) max_i = v;
+            }
+            has_value = true;
+        }
+    }
+
+    out->null_count = null_count;
+    out->num_rows = total_rows;
+
+    if (total_rows == 0) {
+        return false;
+    }
+    if (!has_value) {
+        out->type_tag = 'n';
+        return true;
+    }
+    if (kind == 'f') {
+        out->type_tag = 'f';
+        out->min_double = min_d;
+        out->max_double = max_d;
+    } else {
+        out->type_tag = 'i';
+        out->min_int = min_i;
+        out->max_int = max_i;
+    }
+    return true;
+}
 
-                HolderColumnFilter cfi = {};
-                cfi.col_idx = original_col_idx;
+inline unique_ptr<duckdb::ArrowArrayStreamWrapper> HolderFactory::Produce(
+    uintptr_t factory_ptr,
+    ArrowStreamParameters& params)
+{
+    auto* factory = reinterpret_cast<HolderFactory*>(factory_ptr);
+
+    // Full-table scans (projection covering every column in order, no
+    // filters) can consume a stream pre-exported at registration, so the
+    // scan thread never acquires the GIL. An empty projection is the
+    // schema-only probe and keeps the callback path.
+    if ((!params.filters || params.filters->filters.empty()) &&
+        params.projected_columns.columns.size() == factory->column_names.size() &&
+        std::equal(factory->column_names.begin(), factory->column_names.end(),
+                   params.projected_columns.columns.begin())) {
+        if (ArrowArrayStream* preexported = factory->TakePreexportedStream()) {
+            auto wrapper = make_uniq<duckdb::ArrowArrayStreamWrapper>();
+            wrapper->arrow_array_stream = *preexported;
+            preexported->release = nullptr;
+            return wrapper;
+        }
+    }
 
-                HolderFilterInfo* converted = ConvertFilter(filter_ptr.get(), builder);
-                cfi.filter = *converted;
+    HolderProduceParams produce_params = {};
+    std::vector<const char*> col_name_ptrs;
 
-                filter_infos.push_back(cfi);
+    if (!params.projected_columns.columns.empty()) {
+        produce_params.num_projected_cols = params.projected_columns.columns.size();
+        col_name_ptrs.reserve(produce_params.num_projected_cols);
+        for (const auto& col : params.projected_columns.columns) {
+            col_name_ptrs.push_back(col.c_str());
+        }
+        produce_params.projected_col_names = col_name_ptrs.data();
+    }
+
+    // Slabs survive across Produce calls; only the bump pointer rewinds
+    thread_local FilterArena filter_arena;
+    filter_arena.Reset();
+    FilterBuilder builder(filter_arena);
+    std::vector<HolderColumnFilter> filter_infos;
+
+    if (params.filters && !params.filters->filters.empty()) {
+        for (const auto& [col_idx, filter_ptr] : params.filters->filters) {
+            idx_t original_col_idx;
+            auto it = params.projected_columns.filter_to_col.find(col_idx);
+            if (it != params.projected_columns.filter_to_col.end()) {
+                original_col_idx = it->second;
+            } else {
+                original_col_idx = col_idx;
             }
 
-            produce_params.num_filters = filter_infos.size();
-            produce_params.filters = filter_infos.data();
+            HolderColumnFilter cfi = {};
+            cfi.col_idx = original_col_idx;
+
+            HolderFilterInfo* converted = ConvertFilter(filter_ptr.get(), builder);
+            cfi.filter = *converted;
+
+            filter_infos.push_back(cfi);
         }
 
-        HolderProduceResult result = factory->produce_callback(factory->holder_ptr, &produce_params);
+        produce_params.num_filters = filter_infos.size();
+        produce_params.filters = filter_infos.data();
+    }
 
-        if (!result.stream_ptr) {
-            throw std::runtime_error("Data holder returned null stream");
+    // Partitioned path: let the holder return N independent streams
+    if (factory->partitioned_produce_callback) {
+        constexpr size_t MAX_PRODUCE_PARTITIONS = 64;
+        void* stream_ptrs[MAX_PRODUCE_PARTITIONS] = {};
+        void* capsule_ptrs[MAX_PRODUCE_PARTITIONS] = {};
+
+        HolderPartitionedProduceResult partitioned = {};
+        partitioned.max_streams = MAX_PRODUCE_PARTITIONS;
+        partitioned.stream_ptrs = stream_ptrs;
+        partitioned.capsule_pyobjs = capsule_ptrs;
+
+        factory->partitioned_produce_callback(factory->holder_ptr, &produce_params, &partitioned);
+
+        if (partitioned.num_streams > 0) {
+            auto* merger = new PartitionedArrowStreamWrapper();
+            merger->factory = factory;
+            merger->streams.reserve(partitioned.num_streams);
+            merger->capsules.reserve(partitioned.num_streams);
+
+            for (size_t i = 0; i < partitioned.num_streams; i++) {
+                ArrowArrayStream* source = reinterpret_cast<ArrowArrayStream*>(partitioned.stream_ptrs[i]);
+                merger->streams.push_back(*source);
+                source->release = nullptr;
+                merger->capsules.push_back(partitioned.capsule_pyobjs[i]);
+            }
+
+            // Snapshot the schema while partition 0 is still intact; once
+            // consumption starts, exhausted partitions are released
+            ArrowArrayStream& first = merger->streams[0];
+            if (first.get_schema(&first, &merger->cached_schema.arrow_schema) != 0) {
+                const char* err = first.get_last_error ? first.get_last_error(&first) : nullptr;
+                std::string error_msg = err ? err : "Unknown error";
+                for (size_t i = 0; i < merger->streams.size(); i++) {
+                    merger->FinishStream(i);
+                }
+                delete merger;
+                throw std::runtime_error("Failed to get schema from partition stream: " + error_msg);
+            }
+
+            auto wrapper = make_uniq<duckdb::ArrowArrayStreamWrapper>();
+            wrapper->arrow_array_stream.private_data = merger;
+            wrapper->arrow_array_stream.get_schema = PartitionedArrowStreamWrapper::GetSchema;
+            wrapper->arrow_array_stream.get_next = PartitionedArrowStreamWrapper::GetNext;
+            wrapper->arrow_array_stream.release = PartitionedArrowStreamWrapper::Release;
+            wrapper->arrow_array_stream.get_last_error = PartitionedArrowStreamWrapper::GetLastError;
+
+            return wrapper;
         }
+        // 0 streams: holder declined partitioning, fall through to single-stream path
+    }
 
-        ArrowArrayStream* source = reinterpret_cast<ArrowArrayStream*>(result.stream_ptr);
-        auto wrapper = make_uniq<duckdb::ArrowArrayStreamWrapper>();
-        wrapper->arrow_array_stream = *source;
-        source->release = nullptr;
+    HolderProduceResult result = factory->produce_callback(factory->holder_ptr, &produce_params);
 
-        return wrapper;
+    if (!result.stream_ptr) {
+        throw std::runtime_error("Data holder returned null stream");
+    }
+
+    ArrowArrayStream* source = reinterpret_cast<ArrowArrayStream*>(result.stream_ptr);
+    auto wrapper = make_uniq<duckdb::ArrowArrayStreamWrapper>();
+    wrapper->arrow_array_stream = *source;
+    source->release = nullptr;
+
+    // Re-check pushed filters natively - holders may have skipped predicates
+    // they could not translate
+    if (!filter_infos.empty()) {
+        AttachBatchFilterStage(*wrapper, filter_infos, factory->column_names, params);
     }
-};
+
+    return wrapper;
+}
 
 extern "C" void* register_holder_cpp(
     duckdb_connection c_conn,
@@ -421,6 +1536,7 @@ extern "C" void* register_holder_cpp(
     size_t stats_count,
     const ColumnStatsInput* stats,
     holder_produce_callback_t callback,
+    holder_produce_partitioned_callback_t partitioned_callback,
     holder_release_capsule_callback_t release_callback,
     holder_get_schema_callback_t get_schema_callback,
     size_t num_columns,
@@ -446,6 +1562,7 @@ extern "C" void* register_holder_cpp(
     auto factory = make_uniq<HolderFactory>(
         holder_pyobj,
         callback,
+        partitioned_callback,
         release_callback,
         col_names,
         num_rows,
@@ -491,12 +1608,205 @@ extern "C" void* register_holder_cpp(
     return factory.release();
 }
 
+// Registers N holders in one shot. Factories and their initial schema
+// streams are built up front (the caller holds the GIL), then every view is
+// created inside a single catalog transaction through the parsed
+// CreateViewInfo path - no per-object DROP/CREATE SQL text round-tripping
+// through context->Query. On failure the transaction rolls back and every
+// factory is destroyed, so no views from the batch survive a partial
+// registration. out_factories receives one pointer per entry, index-aligned.
+extern "C" size_t register_holders_batch_cpp(
+    duckdb_connection c_conn,
+    const HolderRegistration* regs,
+    size_t num_regs,
+    holder_produce_callback_t callback,
+    holder_produce_partitioned_callback_t partitioned_callback,
+    holder_release_capsule_callback_t release_callback,
+    bool replace,
+    const char* function_name,
+    void** out_factories)
+{
+    auto conn = get_cpp_connection(c_conn);
+    if (!conn) {
+        throw std::runtime_error("Invalid connection");
+    }
+    auto context = conn->context;
+    std::string func_name(function_name);
+
+    std::vector<unique_ptr<HolderFactory>> factories;
+    factories.reserve(num_regs);
+
+    for (size_t r = 0; r < num_regs; r++) {
+        const HolderRegistration& reg = regs[r];
+        std::vector<std::string> col_names;
+        for (size_t i = 0; i < reg.num_columns; i++) {
+            col_names.push_back(reg.column_names[i]);
+        }
+
+        auto factory = make_uniq<HolderFactory>(
+            reg.holder_pyobj,
+            callback,
+            reg.use_partitioned ? partitioned_callback : nullptr,
+            (reg.use_partitioned || reg.use_deferred_release) ? release_callback : nullptr,
+            col_names,
+            reg.num_rows,
+            reg.stats_count,
+            reg.stats,
+            reg.supports_views);
+
+        HolderProduceParams initial_params = {};
+        HolderProduceResult initial_result = callback(reg.holder_pyobj, &initial_params);
+        if (!initial_result.stream_ptr) {
+            throw std::runtime_error(
+                "Failed to get initial stream from holder '" + std::string(reg.view_name) + "'");
+        }
+
+        ArrowArrayStream* stream = reinterpret_cast<ArrowArrayStream*>(initial_result.stream_ptr);
+
+        ArrowSchema schema;
+        if (stream->get_schema(stream, &schema) != 0) {
+            const char* err = stream->get_last_error(stream);
+            std::string error_msg = err ? err : "Unknown error";
+            stream->release(stream);
+            throw std::runtime_error(
+                "Failed to get schema for '" + std::string(reg.view_name) + "': " + error_msg);
+        }
+
+        factory->schema_capsule_pyobj = initial_result.capsule_pyobj;
+        factory->cached_schema.arrow_schema = schema;
+        factories.push_back(std::move(factory));
+    }
+
+    // One transaction for the whole batch: the views share catalog
+    // lock/version work instead of paying it per object
+    context->RunFunctionInTransaction([&]() {
+        auto& catalog = duckdb::Catalog::GetCatalog(*context, TEMP_CATALOG);
+        for (size_t r = 0; r < num_regs; r++) {
+            auto view_info = make_uniq<duckdb::CreateViewInfo>();
+            view_info->catalog = TEMP_CATALOG;
+            view_info->schema = DEFAULT_SCHEMA;
+            view_info->view_name = regs[r].view_name;
+            view_info->temporary = true;
+            view_info->on_conflict = replace ? duckdb::OnCreateConflict::REPLACE_ON_CONFLICT
+                                             : duckdb::OnCreateConflict::ERROR_ON_CONFLICT;
+
+            vector<unique_ptr<duckdb::ParsedExpression>> children;
+            children.push_back(make_uniq<duckdb::ConstantExpression>(
+                Value::POINTER(CastPointerToValue(factories[r].get()))));
+            children.push_back(make_uniq<duckdb::ConstantExpression>(
+                Value::POINTER(CastPointerToValue(&HolderFactory::Produce))));
+            children.push_back(make_uniq<duckdb::ConstantExpression>(
+                Value::POINTER(CastPointerToValue(&HolderFactory::GetSchema))));
+            children.push_back(make_uniq<duckdb::ConstantExpression>(
+                Value::POINTER(CastPointerToValue(&HolderFactory::GetCardinality))));
+
+            auto table_function = make_uniq<duckdb::TableFunctionRef>();
+            table_function->function = make_uniq<duckdb::FunctionExpression>(
+                func_name, std::move(children));
+
+            auto node = make_uniq<duckdb::SelectNode>();
+            node->select_list.push_back(make_uniq<duckdb::StarExpression>());
+            node->from_table = std::move(table_function);
+            auto select = make_uniq<duckdb::SelectStatement>();
+            select->node = std::move(node);
+            view_info->query = std::move(select);
+
+            auto bound_info = duckdb::CreateViewInfo::FromSelect(*context, std::move(view_info));
+            catalog.CreateView(*context, *bound_info);
+        }
+    });
+
+    for (size_t r = 0; r < num_regs; r++) {
+        out_factories[r] = factories[r].release();
+    }
+    return num_regs;
+}
+
+// Hands the factory a ready ArrowArrayStream over the holder's full table.
+// Called with the GIL held; the factory takes ownership of the stream and
+// holds the capsule reference until destruction. Each pre-exported stream
+// satisfies exactly one projection/filter-free scan, after which scans fall
+// back to the produce callback.
+extern "C" bool add_preexported_stream_cpp(
+    void* factory_ptr,
+    void* stream_ptr,
+    void* capsule_pyobj)
+{
+    if (!factory_ptr || !stream_ptr || !capsule_pyobj) {
+        return false;
+    }
+    auto* stream = reinterpret_cast<ArrowArrayStream*>(stream_ptr);
+    if (!stream->release) {
+        return false;
+    }
+    reinterpret_cast<HolderFactory*>(factory_ptr)->AddPreexportedStream(stream, capsule_pyobj);
+    return true;
+}
+
 extern "C" void delete_holder_factory_cpp(void* factory_ptr) {
     if (factory_ptr) {
         delete reinterpret_cast<HolderFactory*>(factory_ptr);
     }
 }
 
+// Attaches per-connection memory accounting to a registered factory. Kept
+// out of the registration signatures: registration predates the accounting
+// object in some call paths, and a no-op attach (null accounting) keeps the
+// callers unconditional.
+extern "C" void holder_factory_set_accounting(void* factory_ptr, void* accounting_ptr) {
+    if (!factory_ptr) {
+        return;
+    }
+    reinterpret_cast<HolderFactory*>(factory_ptr)->AttachAccounting(
+        reinterpret_cast<ConnectionMemoryAccounting*>(accounting_ptr));
+}
+
+// Swaps the data behind an existing registration in place. The view, the
+// HolderFactory and its cached schema all survive, so refreshing a growing
+// table costs O(delta) instead of catalog churn plus a schema re-fetch.
+// The new holder must expose the same column schema; the caller passes the
+// refreshed row count and statistics. Returns the replaced holder pointer
+// so the caller can drop its reference, or nullptr on invalid input. Must
+// not be called while a scan of this registration is in flight.
+extern "C" void* update_holder_cpp(
+    void* factory_ptr,
+    void* new_holder_pyobj,
+    int64_t num_rows,
+    size_t stats_count,
+    const ColumnStatsInput* stats)
+{
+    if (!factory_ptr || !new_holder_pyobj) {
+        return nullptr;
+    }
+    auto* factory = reinterpret_cast<HolderFactory*>(factory_ptr);
+
+    // Unconsumed pre-exported streams carry the old holder's data - drop
+    // them before the swap. Entered from Python, so the GIL is held.
+    {
+        std::lock_guard<std::mutex> lock(factory->preexport_mutex);
+        for (auto& entry : factory->preexported_streams) {
+            auto it = std::find(factory->preexport_capsules.begin(),
+                                factory->preexport_capsules.end(), entry.second);
+            if (it != factory->preexport_capsules.end()) {
+                factory->preexport_capsules.erase(it);
+            }
+            Py_DECREF(reinterpret_cast<PyObject*>(entry.second));
+        }
+        factory->preexported_streams.clear();
+    }
+
+    void* old_holder = factory->holder_ptr;
+    factory->holder_ptr = new_holder_pyobj;
+    factory->num_rows = num_rows;
+    factory->precomputed_stats.clear();
+    factory->ParseStats(stats_count, stats);
+
+    // Capsules queued by completed scans of the old data can go now
+    factory->FlushPendingReleases();
+
+    return old_holder;
+}
+
 }  // namespace bareduckdb
 
 
@@ -104,6 +104,25 @@ class Result:
 
             raise RuntimeError("No _table or _result")
 
+    def to_shared(self, path: str | None = None) -> str:
+        """
+        Write the result to a shared-memory IPC segment for another process.
+
+        Returns the segment path; the consumer reconstructs the batches
+        zero-copy with bareduckdb.read_shared_result(path).
+        """
+        from ..core.shared_result import write_shared_result
+
+        with self._result_lock:
+            if self._table is not None:
+                return write_shared_result(self._table, path)
+            if self._reader is not None:
+                self._read = True
+                _reader = self._reader
+                self._reader = None
+                return write_shared_result(_reader, path)
+            raise RuntimeError("Reader already consumed")
+
     def df(self, arrow_dtyped: bool = True) -> "pd.DataFrame":
         if arrow_dtyped:
             try:
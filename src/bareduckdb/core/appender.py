@@ -42,6 +42,9 @@ class Appender:
         table: str,
         schema: str | None = None,
         catalog: str | None = None,
+        pipelined: bool = False,
+        flush_rows: int = 122880,
+        buffers: int = 2,
     ) -> None:
         """
         Create an appender for the specified table.
@@ -51,8 +54,18 @@ class Appender:
             table: Target table name
             schema: Schema name (optional, defaults to current schema)
             catalog: Catalog name (optional, for multi-catalog databases)
+            pipelined: Flush filled buffers on a background thread while
+                rows keep appending on the caller's thread
+            flush_rows: Rows per buffer before it is handed to the flush
+                thread (pipelined mode only); keep below DuckDB's internal
+                204800-row auto-flush
+            buffers: Buffers in rotation (pipelined mode only, minimum 2);
+                appends block when all buffers are in flight
         """
-        self._impl = AppenderImpl(connection._impl, table, schema, catalog)
+        self._impl = AppenderImpl(
+            connection._impl, table, schema, catalog,
+            pipelined=pipelined, flush_rows=flush_rows, buffers=buffers,
+        )
 
     def append_row(self, *values: Any) -> Appender:
         """
@@ -81,6 +94,23 @@ class Appender:
         self._impl.append_rows(rows)
         return self
 
+    def append_arrow(self, data: Any) -> Appender:
+        """
+        Bulk-append Arrow data in a single native call.
+
+        Accepts anything implementing __arrow_c_stream__ (pyarrow Table,
+        RecordBatch, RecordBatchReader, polars DataFrame, ...) or an
+        ArrowArrayStream PyCapsule. Much faster than append_rows for large
+        batches - no per-value Python->C transitions.
+
+        Stream columns must match the table's column order.
+
+        Returns:
+            self for chaining
+        """
+        self._impl.append_arrow(data)
+        return self
+
     def append_default(self) -> Appender:
         """
         Append the DEFAULT value for the current column.
@@ -188,6 +188,12 @@ class ConnectionAPI(ConnectionBase):
         if not self.enable_replacement_scan and len(self._udtf_registry) == 0:
             return query, data
 
+        # Fast path: skip the parse/walk entirely when no registered UDTF name
+        # appears in the query text (cheap substring check; false positives
+        # just fall through to the parser)
+        if not self.enable_replacement_scan and not any(name in query for name in self._udtf_registry):
+            return query, data
+
         # using DuckDB Parser
         try:
             parse_result = self._impl.parse_sql(query)
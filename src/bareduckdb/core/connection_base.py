@@ -5,8 +5,10 @@ Core bindings to DuckDB Connections, Registration and Executions
 from __future__ import annotations
 
 import logging
+import os
 import threading
 import time
+from collections import OrderedDict
 from typing import TYPE_CHECKING
 
 from .impl.connection import ConnectionImpl  # type: ignore[import-untyped]
@@ -39,6 +41,8 @@ class ConnectionBase:
     _MODE_ARROW = "arrow"
     _MODE_ARROW_CAPSULE = "arrow_capsule"
     _MODE_STREAM = "stream"
+    _MODE_STREAM_PREFETCH = "stream_prefetch"
+    _MODE_STREAM_PARALLEL = "stream_parallel"
 
     # Instance attributes
     _impl: Any
@@ -73,6 +77,13 @@ class ConnectionBase:
             init_sql: SQL to run when creating the connection
             _from_impl: Internal parameter for creating cursor with shared database
         """
+        # Opt-in materialized-result reuse (see enable_result_cache). Entries
+        # are keyed by query text and tagged with the registration version at
+        # execution time; any registration change or write invalidates them.
+        self._result_cache_enabled = False
+        self._result_cache_capacity = 32
+        self._result_cache: OrderedDict[str, tuple[int, Any]] = OrderedDict()
+        self._registration_version = 0
 
         if _from_impl is not None:
             # Creating a cursor - use the provided ConnectionImpl directly
@@ -110,6 +121,49 @@ class ConnectionBase:
                 read_only,
             )
 
+    # Parsed statement types that cannot mutate database state; only these
+    # are safe to serve from (and store into) the result cache. DESCRIBE,
+    # SHOW, SUMMARIZE and FROM-first queries all parse to SELECT.
+    _READ_ONLY_STATEMENT_TYPES = frozenset({"SELECT", "EXPLAIN", "RELATION"})
+
+    def _is_read_only_statement(self, query: str) -> bool:
+        body = query.strip().rstrip(";")
+        if ";" in body:
+            return False  # multi-statement - assume it can write
+        # Classification comes from the parser (cached, so repeat queries
+        # pay a lookup), not text prefixes: a CTE-prefixed statement like
+        # "WITH cte AS (...) INSERT INTO t ..." parses as INSERT and must
+        # not be cached or allowed to skip invalidation
+        parsed = self._impl.parse_sql(query)
+        if parsed.get("error"):
+            return False  # unparseable - assume it can write
+        return parsed.get("statement_type") in ConnectionBase._READ_ONLY_STATEMENT_TYPES
+
+    def enable_result_cache(self, enabled: bool = True, *, capacity: int = 32) -> None:
+        """
+        Toggle reuse of materialized arrow_table results for repeated queries.
+
+        A cache hit returns the previously materialized (immutable) pa.Table
+        without re-running the query. Entries are invalidated by any
+        registration change, unregistration, or statement that can write.
+        Off by default; parameterized queries and replacement-scan data
+        always bypass the cache.
+        """
+        with self._lock:
+            self._result_cache_enabled = enabled
+            self._result_cache_capacity = capacity
+            if not enabled:
+                self._result_cache.clear()
+
+    def clear_result_cache(self) -> None:
+        """Drop all cached query results."""
+        with self._lock:
+            self._result_cache.clear()
+
+    def _bump_registration_version(self) -> None:
+        """Invalidate cached results after a registration or data change."""
+        self._registration_version += 1
+
     def _register_arrow(
         self,
         name: str,
@@ -130,6 +184,31 @@ class ConnectionBase:
         logger.debug("DataHolder unavailable for %s, using capsule registration", type(data).__name__)
         self._register_capsule(name, data)
 
+    def _register_arrow_many(
+        self,
+        data: dict[str, Any],
+        registered: list[str],
+        statistics: "list[str] | Literal['numeric'] | str | bool | None" = None,
+    ) -> None:
+        """
+        Register several data sources at once.
+
+        Holder-registrable entries share one catalog transaction instead of
+        paying catalog/view creation per object; anything get_holder cannot
+        wrap falls back to capsule registration individually. Appends every
+        registered name to `registered` so the caller can unregister them.
+        """
+        effective_statistics = statistics if statistics is not None else self._default_statistics
+
+        from ..dataset import register_tables
+
+        unsupported = register_tables(self, data, statistics=effective_statistics)
+        registered.extend(name for name in data if name not in unsupported)
+        for name in unsupported:
+            logger.debug("DataHolder unavailable for %s, using capsule registration", type(data[name]).__name__)
+            self._register_capsule(name, data[name])
+            registered.append(name)
+
     def _register_capsule(
         self, name: str, capsule: PyArrowCapsule | pa.Table | ds.Dataset | ds.Scanner | pd.DataFrame | pl.DataFrame | pl.LazyFrame | pa.RecordBatchReader
     ) -> None:
@@ -169,8 +248,66 @@ class ConnectionBase:
         # Assume it's a capsule already
 
         self._registered_objects[name] = data
+        self._bump_registration_version()
         self._impl.register_capsule(name, data, cardinality, replace=True)
 
+    def load_table(
+        self,
+        table: str,
+        data: Any,
+        *,
+        schema: str | None = None,
+        create: bool = True,
+        replace: bool = False,
+        partitions: int | None = None,
+    ) -> int:
+        """
+        Bulk-load a data source into a persistent table.
+
+        Unlike ``CREATE TABLE AS SELECT * FROM view``, the data never passes
+        through the planner: the source's Arrow stream feeds DuckDB's
+        appender directly. Holders that can split into independent partition
+        streams (in-memory Arrow tables) are consumed in parallel, one
+        worker thread per partition.
+
+        Args:
+            table: Target table name
+            data: Data source (PyArrow Table, Polars DataFrame, anything
+                with __arrow_c_stream__)
+            schema: Target schema name, or None for the default
+            create: Create the table from the source schema first (default)
+            replace: With create, replace an existing table
+            partitions: Max parallel partition streams; defaults to the
+                machine's CPU count. Sources that cannot partition load
+                through a single stream regardless.
+
+        Returns:
+            Number of rows loaded
+        """
+        from bareduckdb.data_sources import get_holder
+
+        capsules: list[Any] | None = None
+        holder = get_holder(data)
+        if holder is not None:
+            max_partitions = partitions if partitions is not None else (os.cpu_count() or 1)
+            producer = getattr(holder, "produce_filtered_partitioned", None)
+            if producer is not None and max_partitions > 1:
+                capsules = producer(list(holder.column_names), None, max_partitions)
+            if capsules is None:
+                capsules = [holder.produce_filtered(list(holder.column_names), None)]
+        elif hasattr(data, "__arrow_c_stream__"):
+            capsules = [data.__arrow_c_stream__()]
+        else:
+            raise TypeError(f"Cannot bulk-load {type(data).__name__}: no holder and no __arrow_c_stream__")
+
+        with self._lock:
+            self._bump_registration_version()  # table contents changed
+            rows = self._impl.bulk_load_arrow(
+                table, capsules, schema=schema, create_table=create, replace=replace
+            )
+        logger.debug("Bulk-loaded %d rows into '%s' from %d stream(s)", rows, table, len(capsules))
+        return rows
+
     def _call(
         self,
         query: str,
@@ -179,27 +316,78 @@ class ConnectionBase:
         parameters: Sequence[Any] | Mapping[str, Any] | None = None,
         data: Mapping[str, Any] | None = None,
         batch_size: int = 1_000_000,
+        batch_bytes: int | None = None,
+        prefetch: bool = False,
+        parallel: bool = False,
+        spill_threshold: int | None = None,
     ) -> pa.Table | pa.RecordBatchReader | PyArrowCapsule:
         """
         Core execution method - executes query and returns result in requested format.
 
         Args:
             query: SQL query string
-            output_type: Output format ("arrow_table", "arrow_reader", "arrow_capsule")
+            output_type: Output format ("arrow_table", "arrow_reader", "arrow_capsule",
+                "numpy_columns" for a dict of NumPy column arrays)
             parameters: Query parameters (positional list or named dict, keyword-only)
             data: dict of objects for replacement scanning
             batch_size [1_000_000]: Arrow batch size
+            batch_bytes: For streaming outputs, target batch size in bytes
+                instead of rows - the first chunk calibrates bytes-per-row
+                and later batches resize toward this footprint, so narrow
+                and wide results stream at comparable granularity
+            prefetch: For streaming outputs, fetch chunks on a background
+                thread so DuckDB execution overlaps with consumption
+            parallel: For streaming outputs, materialize the result and
+                convert its chunks to Arrow on a worker pool (batches still
+                arrive in order); helps wide VARCHAR-heavy results
+            spill_threshold: For arrow_table output, bound in-memory
+                collection to this many bytes; larger results spill to an
+                Arrow IPC temp file and come back memory-mapped zero-copy
+                instead of OOMing
 
         Returns:
             Result in requested format (pa.Table, pa.RecordBatchReader, or capsule)
         """
         with self._lock:
+            cacheable = (
+                self._result_cache_enabled
+                and output_type == "arrow_table"
+                and parameters is None
+                and not data
+                and spill_threshold is None
+                and self._is_read_only_statement(query)
+            )
+            if cacheable:
+                cached = self._result_cache.get(query)
+                if cached is not None and cached[0] == self._registration_version:
+                    self._result_cache.move_to_end(query)
+                    logger.debug("Result cache hit")
+                    return cached[1]
+            elif self._result_cache and not self._is_read_only_statement(query):
+                # A statement that can write invalidates every cached result
+                self._registration_version += 1
+
             if output_type == "arrow_table":
-                mode = ConnectionBase._MODE_ARROW if self.arrow_table_collector == "arrow" else ConnectionBase._MODE_STREAM
+                if spill_threshold is not None:
+                    # Stream chunks so the full result never sits in memory;
+                    # collection is bounded by materialize_with_spill
+                    mode = ConnectionBase._MODE_STREAM
+                else:
+                    mode = ConnectionBase._MODE_ARROW if self.arrow_table_collector == "arrow" else ConnectionBase._MODE_STREAM
             elif output_type == "arrow_reader":
-                mode = ConnectionBase._MODE_STREAM
+                if parallel:
+                    # Materialize, then convert chunks to Arrow on a worker pool
+                    mode = ConnectionBase._MODE_STREAM_PARALLEL
+                else:
+                    mode = ConnectionBase._MODE_STREAM_PREFETCH if prefetch else ConnectionBase._MODE_STREAM
             elif output_type in ("arrow_capsule", "pl"):
-                mode = ConnectionBase._MODE_ARROW_CAPSULE
+                if parallel:
+                    mode = ConnectionBase._MODE_STREAM_PARALLEL
+                else:
+                    mode = ConnectionBase._MODE_STREAM_PREFETCH if prefetch else ConnectionBase._MODE_ARROW_CAPSULE
+            elif output_type == "numpy_columns":
+                # Direct columnar export needs the materialized collector
+                mode = ConnectionBase._MODE_ARROW
             else:
                 raise ValueError(f"Invalid output_type: {output_type}")
 
@@ -213,12 +401,21 @@ class ConnectionBase:
 
             try:
                 if data:
-                    for name, data_obj in data.items():
-                        self._register_arrow(name, data_obj)
-                        _data_to_unregister.append(name)
+                    if len(data) > 1:
+                        self._register_arrow_many(data, _data_to_unregister)
+                    else:
+                        for name, data_obj in data.items():
+                            self._register_arrow(name, data_obj)
+                            _data_to_unregister.append(name)
 
                 t_exec_start = time.perf_counter()
-                base_result = self._impl.call_impl(query=query, mode=mode, batch_size=batch_size, parameters=parameters)
+                base_result = self._impl.call_impl(
+                    query=query,
+                    mode=mode,
+                    batch_size=batch_size,
+                    parameters=parameters,
+                    batch_bytes=batch_bytes or 0,
+                )
                 t_exec_end = time.perf_counter()
                 logger.debug("Query execution: %.4fs", (t_exec_end - t_exec_start))
 
@@ -231,9 +428,21 @@ class ConnectionBase:
                         logger.debug("pyarrow not available, returning capsule")
                         return base_result.__arrow_c_stream__(None)
 
-                    result = base_result.to_arrow()
+                    if spill_threshold is not None:
+                        import pyarrow as pa
+                        from .spill_result import materialize_with_spill
+
+                        capsule = base_result.__arrow_c_stream__(None)
+                        reader = pa.RecordBatchReader._import_from_c_capsule(capsule)
+                        result = materialize_with_spill(reader, spill_threshold)
+                    else:
+                        result = base_result.to_arrow()
                     t_convert_end = time.perf_counter()
                     logger.debug("Arrow conversion: %.4fs", (t_convert_end - t_convert_start))
+                    if cacheable:
+                        self._result_cache[query] = (self._registration_version, result)
+                        while len(self._result_cache) > self._result_cache_capacity:
+                            self._result_cache.popitem(last=False)
                     return result
                 elif output_type == "arrow_reader":  # return capsule as a RecordBatchReader
                     import pyarrow as pa  # type: ignore[import]
@@ -242,12 +451,100 @@ class ConnectionBase:
                     return pa.RecordBatchReader._import_from_c_capsule(capsule)  # type: ignore
                 elif output_type == "arrow_capsule":
                     return base_result.__arrow_c_stream__(None)
+                elif output_type == "numpy_columns":
+                    # One C pass from DuckDB's collected Arrow buffers into
+                    # contiguous NumPy column buffers - no pyarrow batches
+                    return base_result.to_numpy_columns()
                 else:
                     raise ValueError(f"Invalid output_type: {output_type}")
             finally:
                 for name in _data_to_unregister:
                     self.unregister(name)
 
+    def _execute_many(self, query: str, parameters_seq: Sequence[Sequence[Any] | Mapping[str, Any]]) -> int:
+        """
+        Execute a parameterized statement once per parameter set.
+
+        The prepared statement is reused across all bindings and parameter
+        columns are converted with type-specialized batch loops. Results
+        are discarded; returns the number of parameter sets executed.
+        """
+        with self._lock:
+            self._registration_version += 1  # bulk writes invalidate cached results
+            return self._impl.execute_many(query=query, parameters_seq=parameters_seq)
+
+    def enable_query_timings(self, enabled: bool = True) -> None:
+        """
+        Toggle per-phase query instrumentation.
+
+        When enabled, the native layer accumulates monotonic nanosecond
+        counters for prepare, execute, collect, schema export and array
+        export, plus batch/row totals. Disabled (the default), instrumented
+        paths pay a single flag check.
+        """
+        from bareduckdb.core.impl.result import set_query_timing_enabled
+
+        set_query_timing_enabled(enabled)
+
+    def query_timings(self, *, reset: bool = False) -> dict[str, int]:
+        """
+        Snapshot the calling thread's per-phase query counters.
+
+        Counters accumulate across queries on this thread; pass reset=True
+        to zero them after reading (typical per-query usage: reset, run,
+        read).
+        """
+        from bareduckdb.core.impl.result import get_query_timings, reset_query_timings
+
+        timings = get_query_timings()
+        if reset:
+            reset_query_timings()
+        return timings
+
+    def reset_query_timings(self) -> None:
+        """Zero the calling thread's per-phase query counters."""
+        from bareduckdb.core.impl.result import reset_query_timings
+
+        reset_query_timings()
+
+    def memory_stats(self) -> dict[str, int]:
+        """
+        Snapshot of native memory this connection holds outside DuckDB's
+        buffer manager.
+
+        Keys: result_bytes (materialized Arrow results still alive),
+        stream_bytes (streaming batches in flight), holder_bytes (registered
+        holder metadata), total_bytes, peak_bytes and limit_bytes. Values
+        are measured from the exported Arrow buffers and are a floor -
+        exotic layouts the measurer does not understand count as zero.
+        """
+        return self._impl.memory_stats()
+
+    def set_memory_limit(self, limit_bytes: int) -> None:
+        """
+        Cap the accounted native memory for this connection.
+
+        Queries whose materialized results or streaming batches would push
+        the accounted total past the limit raise instead of allocating.
+        Pass 0 to remove the cap.
+        """
+        self._impl.set_memory_limit(limit_bytes)
+
+    def _pending_call(self, query: str, *, batch_size: int = 1_000_000) -> Any:
+        """
+        Launch a query via DuckDB's pending-query API without blocking.
+
+        Returns a pending query object - call poll() until it returns True
+        (one execution task unit per call), then get_result().to_arrow().
+        Used by the aio layer to multiplex in-flight queries on one thread.
+
+        Parameters and replacement-scan data are not supported on this path.
+        """
+        with self._lock:
+            return self._impl.pending_query(
+                query=query, mode=ConnectionBase._MODE_ARROW, batch_size=batch_size
+            )
+
     def unregister(self, name: str) -> None:
         """
         Unregister a previously registered table.
@@ -256,6 +553,7 @@ class ConnectionBase:
             name: Table name to unregister
         """
         logger.debug("Unregistering table: %s", name)
+        self._bump_registration_version()
         with self._DUCKDB_INIT_LOCK:
             self._impl.unregister(name)
 
@@ -274,19 +572,26 @@ class ConnectionBase:
         table: str,
         schema: Optional[str] = None,
         catalog: Optional[str] = None,
+        pipelined: bool = False,
+        flush_rows: int = 122880,
+        buffers: int = 2,
     ) -> "Appender":
         """
         Args:
             table: Target table name
             schema: Schema name (optional, defaults to current schema)
             catalog: Catalog name (optional, for multi-catalog databases)
+            pipelined: Flush filled buffers on a background thread while
+                rows keep appending on the caller's thread
+            flush_rows: Rows per buffer before background flush (pipelined only)
+            buffers: Buffers in rotation (pipelined only, minimum 2)
 
         Returns:
             Appender instance
         """
         from .appender import Appender
 
-        return Appender(self, table, schema, catalog)
+        return Appender(self, table, schema, catalog, pipelined=pipelined, flush_rows=flush_rows, buffers=buffers)
 
     def __enter__(self) -> ConnectionBase:
         return self
@@ -90,3 +90,15 @@ cdef extern from "duckdb.h":
     duckdb_state duckdb_append_blob(
         duckdb_appender appender, const void *data, idx_t length
     ) nogil
+
+
+cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
+    # Background flusher for the pipelined appender mode
+    void* appender_flusher_create() nogil
+    void appender_flusher_donate(void* ptr, duckdb_appender appender) nogil
+    void appender_flusher_submit(void* ptr, duckdb_appender appender) nogil
+    duckdb_appender appender_flusher_acquire(void* ptr) nogil
+    bool appender_flusher_drain(void* ptr) nogil
+    duckdb_appender appender_flusher_take_ready(void* ptr) nogil
+    const char* appender_flusher_error(void* ptr) nogil
+    void appender_flusher_destroy(void* ptr) nogil
@@ -5,12 +5,16 @@
 
 from libc.stdint cimport int64_t
 from libc.stdint cimport uint64_t
+from cpython.ref cimport PyObject
 
 cdef extern from "Python.h":
     char* PyBytes_AsString(object o)
     Py_ssize_t PyBytes_Size(object o)
 
-from bareduckdb.core.impl.connection cimport ConnectionImpl, duckdb_state, DuckDBSuccess
+from bareduckdb.core.impl.connection cimport (
+    ConnectionImpl, duckdb_state, DuckDBSuccess,
+    append_capsule_stream_to_table,
+)
 from bareduckdb.core.impl.appender cimport (
     duckdb_appender, idx_t,
     duckdb_date, duckdb_time, duckdb_timestamp, duckdb_interval,
@@ -25,6 +29,9 @@ from bareduckdb.core.impl.appender cimport (
     duckdb_append_double,
     duckdb_append_date, duckdb_append_time, duckdb_append_timestamp, duckdb_append_interval,
     duckdb_append_varchar_length, duckdb_append_blob,
+    appender_flusher_create, appender_flusher_donate, appender_flusher_submit,
+    appender_flusher_acquire, appender_flusher_drain, appender_flusher_take_ready,
+    appender_flusher_error, appender_flusher_destroy,
 )
 
 from datetime import date, datetime, time, timedelta
@@ -42,14 +49,29 @@ cdef class AppenderImpl:
     cdef bint _closed
     cdef object _connection  # Keep reference to prevent gc
     cdef idx_t _column_count
+    cdef str _table
+    cdef str _schema
+    cdef str _catalog
+    cdef void* _flusher       # AppenderFlusher* when pipelined, else NULL
+    cdef bint _pipelined
+    cdef idx_t _pending_rows
+    cdef idx_t _flush_rows
 
     def __cinit__(self):
         self._appender = NULL
         self._closed = False
         self._connection = None
         self._column_count = 0
+        self._table = None
+        self._schema = None
+        self._catalog = None
+        self._flusher = NULL
+        self._pipelined = False
+        self._pending_rows = 0
+        self._flush_rows = 0
 
-    def __init__(self, ConnectionImpl connection, str table, str schema=None, str catalog=None):
+    def __init__(self, ConnectionImpl connection, str table, str schema=None, str catalog=None,
+                 bint pipelined=False, flush_rows=122880, int buffers=2):
 
         cdef bytes table_bytes = table.encode("utf-8")
         cdef const char* c_table = table_bytes
@@ -69,6 +91,9 @@ cdef class AppenderImpl:
             c_catalog = catalog_bytes
 
         self._connection = connection
+        self._table = table
+        self._schema = schema
+        self._catalog = catalog
 
         if catalog is not None:
             with nogil:
@@ -90,6 +115,76 @@ cdef class AppenderImpl:
         # Get column count
         self._column_count = duckdb_appender_column_count(self._appender)
 
+        if pipelined:
+            self._init_pipelined(connection, c_catalog, c_schema, c_table, flush_rows, buffers)
+
+    cdef void _init_pipelined(self, ConnectionImpl connection, const char* c_catalog,
+                              const char* c_schema, const char* c_table,
+                              object flush_rows, int buffers) except *:
+        """
+        Set up the background flush pipeline: extra appenders to the same
+        table rotate through a C++ worker thread, so row appends on the
+        caller's thread overlap DuckDB's storage writes. The default
+        flush_rows stays below DuckDB's internal 204800-row auto-flush so
+        the filling appender never writes through the connection itself.
+        """
+        cdef duckdb_state state
+        cdef duckdb_appender spare
+        cdef int i
+
+        if flush_rows < 1:
+            raise ValueError("flush_rows must be positive")
+        if buffers < 2:
+            raise ValueError("pipelined mode needs at least 2 buffers")
+
+        self._flusher = appender_flusher_create()
+        if self._flusher == NULL:
+            raise MemoryError("Failed to create appender flusher")
+
+        for i in range(buffers - 1):
+            spare = NULL
+            if c_catalog != NULL:
+                with nogil:
+                    state = duckdb_appender_create_ext(
+                        connection._conn, c_catalog, c_schema, c_table, &spare
+                    )
+            else:
+                with nogil:
+                    state = duckdb_appender_create(
+                        connection._conn, c_schema, c_table, &spare
+                    )
+            if state != DuckDBSuccess:
+                if spare != NULL:
+                    with nogil:
+                        duckdb_appender_destroy(&spare)
+                raise RuntimeError(f"Failed to create pipelined appender for table '{self._table}'")
+            appender_flusher_donate(self._flusher, spare)
+
+        self._pipelined = True
+        self._flush_rows = <idx_t>flush_rows
+        self._pending_rows = 0
+
+    cdef void _check_flusher_error(self) except *:
+        cdef const char* c_error = appender_flusher_error(self._flusher)
+        if c_error != NULL:
+            raise RuntimeError(f"Background appender flush failed: {c_error.decode('utf-8')}")
+
+    cdef void _rotate(self) except *:
+        """Hand the filled appender to the flush thread and take a free one.
+
+        appender_flusher_acquire blocks until a previously submitted
+        appender has finished flushing - that wait is the backpressure.
+        """
+        cdef duckdb_appender filled = self._appender
+        cdef duckdb_appender next_appender
+        cdef void* flusher = self._flusher
+        with nogil:
+            appender_flusher_submit(flusher, filled)
+            next_appender = appender_flusher_acquire(flusher)
+        self._appender = next_appender
+        self._pending_rows = 0
+        self._check_flusher_error()
+
     cdef str _get_error(self):
         cdef const char* c_error
         if self._appender == NULL:
@@ -274,11 +369,57 @@ cdef class AppenderImpl:
             state = duckdb_appender_end_row(appender)
         self._check_state(state)
 
+        if self._pipelined:
+            self._pending_rows += 1
+            if self._pending_rows >= self._flush_rows:
+                self._rotate()
+
     def append_rows(self, rows):
 
         for row in rows:
             self.append_row(*row)
 
+    def append_arrow(self, object data):
+        """
+        Bulk-append Arrow data to the table in a single native call.
+
+        Accepts anything implementing __arrow_c_stream__ (pyarrow Table,
+        RecordBatch, RecordBatchReader, polars DataFrame, ...) or an
+        ArrowArrayStream PyCapsule directly. The whole batch is ingested
+        via DuckDB's chunk appender path with no per-value Python->C
+        transitions; the GIL is released for the duration of the insert.
+
+        Stream columns must match the table's column order.
+        """
+        if self._closed:
+            raise RuntimeError("Appender is closed")
+
+        if self._catalog is not None:
+            raise RuntimeError("append_arrow does not support catalog-qualified appenders")
+
+        if hasattr(data, "__arrow_c_stream__"):
+            capsule = data.__arrow_c_stream__()
+        else:
+            capsule = data
+
+        # Flush buffered row-by-row appends first so ordering is preserved
+        self.flush()
+
+        cdef ConnectionImpl conn_impl = <ConnectionImpl>self._connection
+        cdef bytes table_bytes = self._table.encode("utf-8")
+        cdef const char* c_table = table_bytes
+        cdef bytes schema_bytes
+        cdef const char* c_schema = NULL
+        cdef void* capsule_ptr = <void*><PyObject*>capsule
+
+        if self._schema is not None:
+            schema_bytes = self._schema.encode("utf-8")
+            c_schema = schema_bytes
+
+        append_capsule_stream_to_table(
+            conn_impl._conn, capsule_ptr, c_schema, c_table
+        )
+
     def append_default(self):
 
         if self._closed:
@@ -297,9 +438,53 @@ cdef class AppenderImpl:
 
         cdef duckdb_state state
         cdef duckdb_appender appender = self._appender
+        cdef void* flusher = self._flusher
+
+        if self._pipelined:
+            # Wait for every in-flight background flush before the sync one
+            # so rows reach storage in submission order
+            with nogil:
+                appender_flusher_drain(flusher)
+            self._check_flusher_error()
+
         with nogil:
             state = duckdb_appender_flush(appender)
         self._check_state(state)
+        self._pending_rows = 0
+
+    cdef str _teardown_pipeline(self):
+        """Drain the flush thread and destroy the spare appenders.
+
+        Returns the first background flush error (or None); cleanup always
+        completes so no handles leak.
+        """
+        cdef duckdb_appender spare
+        cdef void* flusher = self._flusher
+        cdef const char* c_error
+        cdef str flush_error = None
+
+        if flusher == NULL:
+            return None
+
+        with nogil:
+            appender_flusher_drain(flusher)
+        c_error = appender_flusher_error(flusher)
+        if c_error != NULL:
+            flush_error = c_error.decode("utf-8")
+
+        while True:
+            spare = appender_flusher_take_ready(flusher)
+            if spare == NULL:
+                break
+            # Spares are already flushed; close errors here are best effort
+            with nogil:
+                duckdb_appender_close(spare)
+                duckdb_appender_destroy(&spare)
+
+        appender_flusher_destroy(flusher)
+        self._flusher = NULL
+        self._pipelined = False
+        return flush_error
 
     def close(self):
         if self._closed:
@@ -307,6 +492,7 @@ cdef class AppenderImpl:
 
         cdef duckdb_state state
         cdef duckdb_appender appender = self._appender
+        cdef str flush_error = self._teardown_pipeline()
 
         if appender != NULL:
             with nogil:
@@ -326,6 +512,9 @@ cdef class AppenderImpl:
 
         self._closed = True
 
+        if flush_error is not None:
+            raise RuntimeError(f"Background appender flush failed: {flush_error}")
+
     @property
     def column_count(self):
         return self._column_count
@@ -342,6 +531,8 @@ cdef class AppenderImpl:
         return False  # Don't suppress exceptions
 
     def __dealloc__(self):
+        if self._flusher != NULL:
+            self._teardown_pipeline()
         cdef duckdb_appender appender = self._appender
         if appender != NULL and not self._closed:
             # Best effort cleanup - ignore errors during dealloc
@@ -1,7 +1,7 @@
 # cython: language_level=3
 
 from libcpp cimport bool
-from libc.stdint cimport int32_t, int64_t, uint64_t, uintptr_t
+from libc.stdint cimport int32_t, int64_t, uint8_t, uint64_t, uintptr_t
 from libcpp.string cimport string
 from libcpp.map cimport map as cpp_map
 from libcpp.memory cimport unique_ptr, shared_ptr
@@ -35,7 +35,9 @@ cdef extern from "duckdb.hpp" namespace "duckdb":
         duckdb_vector()
         void push_back(T)
         void clear()
+        void reserve(size_t)
         size_t size()
+        T& operator[](size_t)
 
     cdef cppclass DuckDBConnection "duckdb::Connection":
         unique_ptr[PreparedStatement] Prepare(const string&) except +
@@ -108,8 +110,31 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
         duckdb_database db
         DatabaseHandle(duckdb_database) except +
 
+    # Warm-connection free-list shared between a connection and its cursors
+    cdef cppclass ConnectionPool:
+        ConnectionPool(size_t) except +
+
+    duckdb_connection connection_pool_checkout(void* pool_ptr) nogil
+    bool connection_pool_checkin(void* pool_ptr, duckdb_connection conn) nogil
+    size_t connection_pool_idle_count(void* pool_ptr) nogil
+    bool reset_pooled_connection(duckdb_connection conn) nogil
+
     DuckDBConnection* get_cpp_connection(duckdb_connection c_conn) nogil
 
+    # Per-phase query instrumentation (thread-local counters)
+    cdef struct QueryPhaseTimings:
+        int64_t prepare_ns
+        int64_t execute_ns
+        int64_t collect_ns
+        int64_t schema_export_ns
+        int64_t array_export_ns
+        int64_t batches_exported
+        int64_t rows_exported
+
+    void query_timing_set_enabled(bool enabled) nogil
+    void query_timing_reset() nogil
+    void query_timing_get(QueryPhaseTimings* out) nogil
+
     # PhysicalArrowCollector
     QueryResult* execute_with_arrow_collector(
         duckdb_connection c_conn, const char *query, uint64_t batch_size,
@@ -124,15 +149,42 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
     # Prepared / Parameters
     QueryResult* execute_prepared_statement(
         duckdb_connection c_conn, const char *query, void* params_map_ptr,
-        bool allow_stream_result, bool use_arrow_collector, uint64_t batch_size
+        bool allow_stream_result, bool use_arrow_collector, uint64_t batch_size,
+        void* cache_ptr
     ) nogil
 
+    # Prepared statement LRU cache (per connection)
+    void* prepared_cache_create(size_t capacity) nogil
+    void prepared_cache_clear(void* cache_ptr) nogil
+    void prepared_cache_destroy(void* cache_ptr) nogil
+
+    # Pending-query API (incremental execution for asyncio)
+    void* pending_query_create(
+        duckdb_connection c_conn, const char* query,
+        uint64_t batch_size, bool use_arrow_collector
+    ) nogil
+    int pending_query_poll(void* state_ptr) nogil
+    const char* pending_query_error(void* state_ptr) nogil
+    QueryResult* pending_query_get_result(void* state_ptr) nogil
+    void pending_query_destroy(void* state_ptr) nogil
+
     # Capsule
     void register_capsule_stream(
         duckdb_connection c_conn, void* stream_capsule,
         const char* view_name, int64_t cardinality, bool replace
     ) except *
 
+    bool append_capsule_stream_to_table(
+        duckdb_connection c_conn, void* stream_capsule,
+        const char* schema_name, const char* table_name
+    ) except *
+
+    int64_t load_arrow_streams_into_table(
+        duckdb_connection c_conn, void** stream_ptrs, size_t num_streams,
+        const char* schema_name, const char* table_name,
+        bool create_table, bool replace
+    ) except *
+
     void unregister_python_object(duckdb_connection c_conn, const char* view_name) except +
 
     # Common result ops
@@ -143,7 +195,7 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
 
     # PhysicalArrowCollector
     size_t arrow_result_num_arrays(ArrowQueryResult *arrow_result) nogil
-    void* arrow_result_consume_arrays(ArrowQueryResult *arrow_result) nogil
+    void* arrow_result_consume_arrays(ArrowQueryResult *arrow_result, void* accounting_ptr) nogil
     size_t consumed_arrays_size(void* arrays_ptr) nogil
     bool consumed_arrays_export(
         void* arrays_ptr, void* arrow_result_ptr, size_t index,
@@ -155,7 +207,22 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
     bool consumed_arrays_export_array_only(
         void* arrays_ptr, size_t index, ArrowArray *out_array
     ) nogil
+    size_t consumed_arrays_export_all(
+        void* arrays_ptr, ArrowArray *out_arrays, size_t max_arrays
+    ) nogil
+    void release_exported_arrays(ArrowArray *arrays, size_t count) nogil
     void consumed_arrays_free(void* arrays_ptr) nogil
+
+    # Direct columnar export (fixed-width columns -> caller buffers)
+    int64_t numpy_export_num_columns(const ArrowSchema* schema) nogil
+    const char* numpy_export_column_name(const ArrowSchema* schema, size_t col) nogil
+    int numpy_export_column_kind(const ArrowSchema* schema, size_t col, int64_t* out_width) nogil
+    int64_t numpy_export_total_rows(const ArrowArray* arrays, size_t num_arrays) nogil
+    int64_t numpy_export_copy_column(
+        const ArrowArray* arrays, size_t num_arrays, size_t col,
+        int64_t width, void* dest, uint8_t* validity_out
+    ) nogil
+    void release_arrow_schema(ArrowSchema* schema) nogil
     ArrowArray* arrow_result_get_array(ArrowQueryResult *arrow_result, size_t index) nogil
 
     # Streaming Arrow path
@@ -168,6 +235,12 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
         void* state_ptr, uint64_t rows_per_batch, ArrowArray* out_array
     ) nogil
     bool export_streaming_arrow_schema(void* state_ptr, ArrowSchema* out_schema) nogil
+
+    # Parallel chunk->Arrow conversion for materialized results
+    void* create_parallel_arrow_array_stream(
+        QueryResult* result, uint64_t rows_per_batch
+    ) nogil
+    const char* parallel_stream_last_error() nogil
     void free_streaming_arrow_state(void* state_ptr) nogil
 
     # Helpers for LogicalType (used for empty lists)
@@ -193,13 +266,37 @@ cdef extern from "cpp_helpers.hpp" namespace "bareduckdb":
     # ArrowArrayStream functions (returns opaque pointer to ArrowArrayStream)
     void* create_arrow_array_stream_from_arrow_result(ArrowQueryResult* arrow_result) nogil
     void* create_streaming_arrow_array_stream(QueryResult* result, uint64_t rows_per_batch) nogil
+    void* create_streaming_arrow_array_stream_adaptive(
+        QueryResult* result, uint64_t initial_rows_per_batch, uint64_t target_batch_bytes
+    ) nogil
+    void* create_prefetching_arrow_array_stream(QueryResult* result, uint64_t rows_per_batch) nogil
+    void streaming_stream_set_accounting(void* stream_ptr, void* accounting_ptr) nogil
+
+    # Per-connection memory accounting (native buffers held outside DuckDB)
+    cdef struct MemoryAccountingSnapshot:
+        int64_t result_bytes
+        int64_t stream_bytes
+        int64_t holder_bytes
+        int64_t peak_bytes
+        int64_t limit_bytes
+
+    void* memory_accounting_create() nogil
+    void* memory_accounting_retain(void* accounting_ptr) nogil
+    void memory_accounting_destroy(void* accounting_ptr) nogil
+    void memory_accounting_set_limit(void* accounting_ptr, int64_t limit_bytes) nogil
+    void memory_accounting_get(void* accounting_ptr, MemoryAccountingSnapshot* out) nogil
+    const char* memory_accounting_last_error() nogil
 
 # Python class
 cdef class ConnectionImpl:
     cdef shared_ptr[DatabaseHandle] _db_handle
+    cdef shared_ptr[ConnectionPool] _conn_pool
     cdef duckdb_connection _conn
     cdef DuckDBConnection* _cpp_conn
     cdef str _database_path
     cdef bool _closed
+    cdef bool _pool_member
+    cdef void* _stmt_cache
+    cdef void* _mem_accounting
 
     cdef DuckDBConnection* _get_cpp_connection(self) except +
@@ -8,9 +8,21 @@ Cython implementation of DuckDB connection.
 """
 
 from libc.stdint cimport uint64_t, int64_t
+from libc.stdlib cimport malloc, free
 from cpython.ref cimport PyObject
+from cpython.pycapsule cimport PyCapsule_GetPointer
 
-from bareduckdb.core.impl.result cimport _ResultBase
+from bareduckdb.core.impl.result cimport _ResultBase, PendingQueryImpl
+from bareduckdb.core.impl.python_to_value cimport convert_parameter_column, transform_parameters
+
+# Default capacity of the per-connection prepared statement cache
+DEF PREPARED_CACHE_CAPACITY = 64
+
+# Max idle cursor connections kept warm for reuse
+DEF CONNECTION_POOL_CAPACITY = 8
+
+# Leading keywords that invalidate cached prepared statements (DDL)
+_DDL_KEYWORDS = ("CREATE", "DROP", "ALTER")
 
 cdef class ConnectionImpl:
     """
@@ -20,6 +32,9 @@ cdef class ConnectionImpl:
     def __cinit__(self, database=None, config=None, read_only=False):
         self._closed = False
         self._cpp_conn = NULL
+        self._stmt_cache = NULL
+        self._mem_accounting = NULL
+        self._pool_member = False
 
         # Use NULL (empty string) for truly private in-memory database
         if database is None:
@@ -103,8 +118,13 @@ cdef class ConnectionImpl:
             # shared_ptr will automatically close database when it goes out of scope
             raise RuntimeError("Failed to get C++ connection")
 
+        self._stmt_cache = prepared_cache_create(PREPARED_CACHE_CAPACITY)
+        self._mem_accounting = memory_accounting_create()
+        self._conn_pool = shared_ptr[ConnectionPool](new ConnectionPool(CONNECTION_POOL_CAPACITY))
+
     def call_impl(
-        self, *, str query, str mode, uint64_t batch_size, object parameters=None
+        self, *, str query, str mode, uint64_t batch_size, object parameters=None,
+        uint64_t batch_bytes=0
     ):
         """
         Execute SQL query with specified execution mode.
@@ -115,8 +135,11 @@ cdef class ConnectionImpl:
                   - "arrow": PhysicalArrowCollector, materialized
                   - "arrow_capsule": PhysicalArrowCollector, PyCapsule output, no PyArrow needed
                   - "stream": Streaming chunks
+                  - "stream_prefetch": Streaming chunks, fetched ahead by a background thread
             batch_size: Arrow record batch size
             parameters: Query parameters (list or dict) - experimental support
+            batch_bytes: If nonzero, streaming batches adapt toward this many
+                bytes per batch after the first chunk
 
         Returns:
             _ResultBase
@@ -124,14 +147,185 @@ cdef class ConnectionImpl:
         if self._closed:
             raise RuntimeError("Connection is closed")
 
+        # DDL changes catalog objects that cached prepared statements may
+        # reference - invalidate before executing
+        if self._stmt_cache != NULL:
+            leading = query.lstrip()[:8].upper()
+            if leading.startswith(_DDL_KEYWORDS):
+                prepared_cache_clear(self._stmt_cache)
+
         return _ResultBase.create(
-            self, query, batch_size, mode, parameters
+            self, query, batch_size, mode, parameters, batch_bytes
         )
 
+    def pending_query(self, *, str query, str mode, uint64_t batch_size):
+        """
+        Launch a query via DuckDB's pending-query API.
+
+        Returns a PendingQueryImpl - call poll() until it returns True, then
+        get_result(). Lets an asyncio event loop interleave many in-flight
+        queries without blocking a worker thread per query.
+
+        Args:
+            query: SQL query string
+            mode: Execution mode ("arrow" or "stream")
+            batch_size: Arrow record batch size
+        """
+        if self._closed:
+            raise RuntimeError("Connection is closed")
+
+        if self._stmt_cache != NULL:
+            leading = query.lstrip()[:8].upper()
+            if leading.startswith(_DDL_KEYWORDS):
+                prepared_cache_clear(self._stmt_cache)
+
+        return PendingQueryImpl.create(self, query, batch_size, mode)
+
+    def execute_many(self, *, str query, object parameters_seq):
+        """
+        Execute a parameterized statement once per parameter set.
+
+        The prepared statement is built once and reused across all bindings
+        via the prepared statement cache. Positional parameter columns are
+        converted with type-specialized batch loops (int64, double, str,
+        date); mixed-type columns and named (dict) parameter sets fall back
+        to per-value conversion. Results are discarded.
+
+        Args:
+            query: SQL statement with parameter placeholders
+            parameters_seq: Sequence of parameter sets (lists/tuples/dicts)
+
+        Returns:
+            Number of parameter sets executed
+        """
+        if self._closed:
+            raise RuntimeError("Connection is closed")
+
+        if self._stmt_cache != NULL:
+            leading = query.lstrip()[:8].upper()
+            if leading.startswith(_DDL_KEYWORDS):
+                prepared_cache_clear(self._stmt_cache)
+
+        rows = list(parameters_seq)
+        cdef Py_ssize_t num_rows = len(rows)
+        if num_rows == 0:
+            return 0
+
+        cdef vector[case_insensitive_map_t] param_maps
+        cdef duckdb_vector[Value] column_values
+        cdef Py_ssize_t i, j
+        cdef Py_ssize_t num_params = 0
+        cdef bytes key_bytes
+        cdef string key_str
+        cdef bint batched = False
+
+        first = rows[0]
+        if isinstance(first, (list, tuple)):
+            num_params = len(first)
+            batched = True
+            for row in rows:
+                if not isinstance(row, (list, tuple)) or len(row) != num_params:
+                    batched = False
+                    break
+
+        param_maps.resize(num_rows)
+
+        if batched:
+            for j in range(num_params):
+                column = [row[j] for row in rows]
+                if not convert_parameter_column(column, column_values):
+                    batched = False
+                    break
+                key_bytes = str(j + 1).encode("utf-8")  # 1-indexed
+                key_str = key_bytes
+                for i in range(num_rows):
+                    param_maps[i][key_str] = BoundParameterData(column_values[i])
+
+        if not batched:
+            for i in range(num_rows):
+                param_maps[i] = transform_parameters(rows[i])
+
+        cdef bytes query_bytes = query.encode("utf-8")
+        cdef const char* c_query = query_bytes
+        cdef QueryResult* query_result
+        cdef void* cache_ptr = self._stmt_cache
+        cdef duckdb_connection conn = self._conn
+
+        for i in range(num_rows):
+            with nogil:
+                query_result = execute_prepared_statement(
+                    conn, c_query, <void*>&param_maps[i],
+                    False, False, 1_000_000, cache_ptr
+                )
+            if query_result == NULL:
+                raise RuntimeError("Query execution failed")
+            if result_has_error(query_result):
+                error_msg = result_get_error(query_result).decode("utf-8")
+                destroy_query_result(query_result)
+                raise RuntimeError(error_msg)
+            destroy_query_result(query_result)
+
+        return num_rows
+
+    def invalidate_prepared_cache(self):
+        """Drop all cached prepared statements (e.g., after external DDL)."""
+        if self._stmt_cache != NULL:
+            prepared_cache_clear(self._stmt_cache)
+
+    def memory_stats(self):
+        """
+        Snapshot of native memory this connection holds outside DuckDB's
+        buffer manager: materialized Arrow results, in-flight streaming
+        batches and registered holder metadata. Byte counts are measured
+        from the exported Arrow buffers; layouts the walker does not
+        understand count as zero, so values are a floor, not a ceiling.
+        """
+        cdef MemoryAccountingSnapshot snap
+        snap.result_bytes = 0
+        snap.stream_bytes = 0
+        snap.holder_bytes = 0
+        snap.peak_bytes = 0
+        snap.limit_bytes = 0
+        if self._mem_accounting != NULL:
+            memory_accounting_get(self._mem_accounting, &snap)
+        return {
+            "result_bytes": snap.result_bytes,
+            "stream_bytes": snap.stream_bytes,
+            "holder_bytes": snap.holder_bytes,
+            "total_bytes": snap.result_bytes + snap.stream_bytes + snap.holder_bytes,
+            "peak_bytes": snap.peak_bytes,
+            "limit_bytes": snap.limit_bytes,
+        }
+
+    def set_memory_limit(self, int64_t limit_bytes):
+        """
+        Cap the accounted native memory for this connection. Queries whose
+        results or streaming batches would push the total past the limit
+        fail cleanly instead of allocating. 0 removes the cap.
+        """
+        if limit_bytes < 0:
+            raise ValueError("memory limit must be >= 0")
+        if self._mem_accounting != NULL:
+            memory_accounting_set_limit(self._mem_accounting, limit_bytes)
+
     def close(self):
         """Close the database connection."""
         if not self._closed:
-            duckdb_disconnect(&self._conn)
+            if self._stmt_cache != NULL:
+                prepared_cache_destroy(self._stmt_cache)
+                self._stmt_cache = NULL
+            if self._mem_accounting != NULL:
+                # Drops the connection's reference; outstanding results and
+                # streams keep the accounting object alive until consumed
+                memory_accounting_destroy(self._mem_accounting)
+                self._mem_accounting = NULL
+            # Cursor connections go back to the shared pool for reuse;
+            # checkin resets session state and fails when the pool is full
+            if self._pool_member and self._conn_pool.get() != NULL and connection_pool_checkin(<void*>self._conn_pool.get(), self._conn):
+                pass
+            else:
+                duckdb_disconnect(&self._conn)
+            self._conn_pool.reset()
             # Drop our reference to the database
             # The shared_ptr will automatically close the database when the last reference is dropped
             self._db_handle.reset()
@@ -152,6 +346,13 @@ cdef class ConnectionImpl:
         """Get the database path for this connection."""
         return self._database_path
 
+    @property
+    def pool_idle_count(self):
+        """Number of warm cursor connections currently parked in the pool."""
+        if self._conn_pool.get() == NULL:
+            return 0
+        return connection_pool_idle_count(<void*>self._conn_pool.get())
+
     def __repr__(self):
         """String representation."""
         if self._closed:
@@ -173,23 +374,37 @@ cdef class ConnectionImpl:
             raise RuntimeError("Cannot create cursor from closed connection")
 
         cdef duckdb_state state
+        cdef duckdb_connection pooled = NULL
         cdef ConnectionImpl cursor_impl = ConnectionImpl.__new__(ConnectionImpl)
 
         # Share the database handle via shared_ptr (refcount++)
         cursor_impl._db_handle = self._db_handle
+        cursor_impl._conn_pool = self._conn_pool
         cursor_impl._database_path = self._database_path
         cursor_impl._closed = False
+        cursor_impl._pool_member = True
 
-        # Create a new connection for independent query execution
-        state = duckdb_connect(cursor_impl._db_handle.get().db, &cursor_impl._conn)
-        if state != DuckDBSuccess:
-            raise RuntimeError("Failed to create cursor connection")
+        # Reuse a warm pooled connection when available - skips duckdb_connect
+        # (catalog init, client context construction) on the hot path
+        if self._conn_pool.get() != NULL:
+            pooled = connection_pool_checkout(<void*>self._conn_pool.get())
+
+        if pooled != NULL:
+            cursor_impl._conn = pooled
+        else:
+            # Create a new connection for independent query execution
+            state = duckdb_connect(cursor_impl._db_handle.get().db, &cursor_impl._conn)
+            if state != DuckDBSuccess:
+                raise RuntimeError("Failed to create cursor connection")
 
         cursor_impl._cpp_conn = get_cpp_connection(cursor_impl._conn)
         if cursor_impl._cpp_conn == NULL:
             duckdb_disconnect(&cursor_impl._conn)
             raise RuntimeError("Failed to get C++ connection for cursor")
 
+        cursor_impl._stmt_cache = prepared_cache_create(PREPARED_CACHE_CAPACITY)
+        cursor_impl._mem_accounting = memory_accounting_create()
+
         return cursor_impl
 
     def register_capsule(self, str name, object stream_capsule, int64_t cardinality=-1, bool replace=True):
@@ -214,6 +429,59 @@ cdef class ConnectionImpl:
 
         register_capsule_stream(self._conn, capsule_ptr, c_name, cardinality, replace)
 
+    def bulk_load_arrow(self, str table, list stream_capsules, str schema=None,
+                        bint create_table=False, bint replace=False):
+        """
+        Load ArrowArrayStream capsules straight into a table.
+
+        The planner is bypassed entirely: chunks are converted to DataChunks
+        and handed to DuckDB's appender, with one worker thread per stream
+        when several partitions are supplied. The caller must keep the
+        capsules alive for the duration of the call (this method does).
+
+        Args:
+            table: Target table name
+            stream_capsules: List of "arrow_array_stream" PyCapsules; all
+                partitions must share the first stream's schema
+            schema: Target schema name, or None for the default
+            create_table: Create the table from the stream schema first
+            replace: With create_table, use CREATE OR REPLACE
+
+        Returns:
+            Number of rows loaded
+        """
+        if self._closed:
+            raise RuntimeError("Connection is closed")
+
+        cdef bytes table_bytes = table.encode("utf-8")
+        cdef const char* c_table = table_bytes
+        cdef bytes schema_bytes
+        cdef const char* c_schema = NULL
+        cdef size_t n = len(stream_capsules)
+        cdef size_t i
+        cdef int64_t rows
+        cdef void** stream_ptrs
+
+        if schema is not None:
+            schema_bytes = schema.encode("utf-8")
+            c_schema = schema_bytes
+
+        if n == 0:
+            raise ValueError("bulk_load_arrow needs at least one stream")
+
+        stream_ptrs = <void**>malloc(n * sizeof(void*))
+        if stream_ptrs == NULL:
+            raise MemoryError()
+        try:
+            for i in range(n):
+                stream_ptrs[i] = PyCapsule_GetPointer(stream_capsules[i], "arrow_array_stream")
+            rows = load_arrow_streams_into_table(
+                self._conn, stream_ptrs, n, c_schema, c_table, create_table, replace
+            )
+        finally:
+            free(stream_ptrs)
+        return rows
+
     def unregister(self, str name):
         """
         Unregister a previously registered table.
@@ -5,8 +5,16 @@
 #include <memory>
 #include <stdexcept>
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <deque>
+#include <vector>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <condition_variable>
 #include <unordered_map>
 
 #include "duckdb.h"
@@ -14,11 +22,14 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_config.hpp"
+#include "duckdb/main/pending_query_result.hpp"
 #include "duckdb/common/arrow/physical_arrow_collector.hpp"
 #include "duckdb/common/arrow/arrow_query_result.hpp"
 #include "duckdb/common/arrow/arrow_converter.hpp"
 #include "duckdb/common/arrow/arrow_util.hpp"
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/chunk_scan_state/query_result.hpp"
 #include "duckdb/common/error_data.hpp"
 #include "duckdb/main/relation/view_relation.hpp"
@@ -26,6 +37,7 @@
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/function/table/arrow.hpp"
+#include "duckdb/main/appender.hpp"
 #include "duckdb/main/external_dependencies.hpp"
 #include "duckdb/parser/keyword_helper.hpp"
 #include "duckdb/parser/parsed_data/drop_info.hpp"
@@ -89,6 +101,232 @@ namespace bareduckdb
         return cpp_conn;
     }
 
+    // Per-phase query instrumentation. Monotonic nanosecond counters for each
+    // phase of a query round trip, accumulated per thread. Disabled by
+    // default: instrumented paths pay one relaxed atomic load and a branch.
+    // Enable, run the query, read the counters from Python; counters
+    // accumulate across queries until reset.
+    struct QueryPhaseTimings
+    {
+        int64_t prepare_ns;       // Prepare() on prepared-statement cache miss
+        int64_t execute_ns;       // Query()/Execute() incl. collector materialization
+        int64_t collect_ns;       // consuming collected arrays out of the result
+        int64_t schema_export_ns; // ArrowSchema conversion
+        int64_t array_export_ns;  // ArrowArray ownership transfer to Python
+        int64_t batches_exported;
+        int64_t rows_exported;
+    };
+
+    inline std::atomic<bool> &query_timing_flag()
+    {
+        static std::atomic<bool> enabled{false};
+        return enabled;
+    }
+
+    inline QueryPhaseTimings &query_timing_state()
+    {
+        static thread_local QueryPhaseTimings state = {};
+        return state;
+    }
+
+    extern "C" void query_timing_set_enabled(bool enabled)
+    {
+        query_timing_flag().store(enabled, std::memory_order_relaxed);
+    }
+
+    extern "C" void query_timing_reset()
+    {
+        query_timing_state() = {};
+    }
+
+    extern "C" void query_timing_get(QueryPhaseTimings *out)
+    {
+        if (out)
+        {
+            *out = query_timing_state();
+        }
+    }
+
+    // Returns 0 when timing is disabled so the stop side is a no-op
+    inline int64_t query_timing_start()
+    {
+        if (!query_timing_flag().load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    inline void query_timing_stop(int64_t t0, int64_t &counter)
+    {
+        if (t0)
+        {
+            int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count();
+            counter += now - t0;
+        }
+    }
+
+    // Module-wide query generation counter backing the streaming deadlock
+    // check's fast path. Bumped whenever a query starts through this
+    // module's execute helpers; a stream records the value at creation and
+    // an unchanged counter proves no query (and hence no recursive
+    // consumption) has started since - one relaxed load instead of the
+    // DatabaseManager::ActiveQueryNumber() pointer chase per batch.
+    inline std::atomic<uint64_t> &query_generation()
+    {
+        static std::atomic<uint64_t> counter {0};
+        return counter;
+    }
+
+    inline void query_generation_bump()
+    {
+        query_generation().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Per-connection accounting of native memory held outside DuckDB's own
+    // buffer manager: materialized Arrow result arrays, in-flight streaming
+    // batches and holder factory metadata. Counters are relaxed atomics
+    // bumped at the allocation points; an optional cap makes the consuming
+    // query fail cleanly instead of letting the process OOM. Measured sizes
+    // come from the Arrow buffers actually produced, so exotic layouts the
+    // walker doesn't understand count as zero - totals are a floor.
+    struct ConnectionMemoryAccounting
+    {
+        std::atomic<int64_t> result_bytes{0}; // consumed materialized arrays
+        std::atomic<int64_t> stream_bytes{0}; // in-flight streaming batches
+        std::atomic<int64_t> holder_bytes{0}; // holder factory metadata
+        std::atomic<int64_t> peak_bytes{0};
+        std::atomic<int64_t> limit_bytes{0}; // 0 = unlimited
+
+        // Intrusive refcount: results, streams and holder factories can
+        // outlive the connection that created them, so each charged consumer
+        // keeps the accounting object alive until its own release
+        std::atomic<int64_t> refcount{1};
+
+        int64_t Total() const
+        {
+            return result_bytes.load(std::memory_order_relaxed) +
+                   stream_bytes.load(std::memory_order_relaxed) +
+                   holder_bytes.load(std::memory_order_relaxed);
+        }
+
+        void Add(std::atomic<int64_t> &counter, int64_t bytes)
+        {
+            counter.fetch_add(bytes, std::memory_order_relaxed);
+            int64_t total = Total();
+            int64_t peak = peak_bytes.load(std::memory_order_relaxed);
+            while (total > peak &&
+                   !peak_bytes.compare_exchange_weak(peak, total, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void Sub(std::atomic<int64_t> &counter, int64_t bytes)
+        {
+            counter.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        bool WouldExceed(int64_t additional) const
+        {
+            int64_t limit = limit_bytes.load(std::memory_order_relaxed);
+            return limit > 0 && Total() + additional > limit;
+        }
+    };
+
+    struct MemoryAccountingSnapshot
+    {
+        int64_t result_bytes;
+        int64_t stream_bytes;
+        int64_t holder_bytes;
+        int64_t peak_bytes;
+        int64_t limit_bytes;
+    };
+
+    inline ConnectionMemoryAccounting *accounting_retain(ConnectionMemoryAccounting *acc)
+    {
+        if (acc)
+        {
+            acc->refcount.fetch_add(1, std::memory_order_relaxed);
+        }
+        return acc;
+    }
+
+    inline void accounting_release(ConnectionMemoryAccounting *acc)
+    {
+        if (acc && acc->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete acc;
+        }
+    }
+
+    extern "C" void *memory_accounting_create()
+    {
+        return new ConnectionMemoryAccounting();
+    }
+
+    // Takes an extra reference for a consumer that may outlive the
+    // connection (e.g. a result object); paired with memory_accounting_destroy
+    extern "C" void *memory_accounting_retain(void *accounting_ptr)
+    {
+        return accounting_retain(reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr));
+    }
+
+    // Drops one reference; the object survives until every charged consumer
+    // has released its own
+    extern "C" void memory_accounting_destroy(void *accounting_ptr)
+    {
+        accounting_release(reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr));
+    }
+
+    extern "C" void memory_accounting_set_limit(void *accounting_ptr, int64_t limit_bytes)
+    {
+        if (accounting_ptr)
+        {
+            reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr)
+                ->limit_bytes.store(limit_bytes, std::memory_order_relaxed);
+        }
+    }
+
+    extern "C" void memory_accounting_get(void *accounting_ptr, MemoryAccountingSnapshot *out)
+    {
+        if (!accounting_ptr || !out)
+        {
+            return;
+        }
+        auto *acc = reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr);
+        out->result_bytes = acc->result_bytes.load(std::memory_order_relaxed);
+        out->stream_bytes = acc->stream_bytes.load(std::memory_order_relaxed);
+        out->holder_bytes = acc->holder_bytes.load(std::memory_order_relaxed);
+        out->peak_bytes = acc->peak_bytes.load(std::memory_order_relaxed);
+        out->limit_bytes = acc->limit_bytes.load(std::memory_order_relaxed);
+    }
+
+    // Message describing the last memory-cap rejection on this thread, so
+    // callers that only see a null return can still raise a useful error
+    inline std::string &memory_limit_error()
+    {
+        static thread_local std::string err;
+        return err;
+    }
+
+    extern "C" const char *memory_accounting_last_error()
+    {
+        auto &err = memory_limit_error();
+        return err.empty() ? nullptr : err.c_str();
+    }
+
+    // Defined with the streaming helpers below; declared here so the
+    // materialized-result path can measure consumed arrays
+    inline int64_t arrow_column_bytes(const ArrowArray *col, const duckdb::LogicalType &type,
+                                      bool large_offsets);
+    inline int64_t arrow_batch_bytes(const ArrowArray &batch,
+                                     const duckdb::vector<duckdb::LogicalType> &types,
+                                     bool large_offsets);
+
     // Execute query WITHOUT PhysicalArrowCollector
     extern "C" duckdb::QueryResult *execute_without_arrow_collector(
         duckdb_connection c_conn,
@@ -110,7 +348,10 @@ namespace bareduckdb
                 return nullptr;
             }
 
+            query_generation_bump();
+            int64_t t0 = query_timing_start();
             duckdb::unique_ptr<duckdb::QueryResult> result = context->Query(query, allow_stream_result);
+            query_timing_stop(t0, query_timing_state().execute_ns);
 
             // Return raw pointer - caller takes ownership
             return result.release();
@@ -156,7 +397,10 @@ namespace bareduckdb
                     return duckdb::PhysicalArrowCollector::Create(ctx, data, batch_size);
                 };
 
+                query_generation_bump();
+                int64_t t0 = query_timing_start();
                 duckdb::unique_ptr<duckdb::QueryResult> result = context->Query(query, allow_stream_result);
+                query_timing_stop(t0, query_timing_state().execute_ns);
 
                 config.get_result_collector = original;
 
@@ -175,6 +419,163 @@ namespace bareduckdb
         }
     }
 
+    // Native async execution via DuckDB's pending-query API.
+    // pending_query_create launches the query, pending_query_poll executes one
+    // task unit at a time (so asyncio can interleave without burning a worker
+    // thread per in-flight query), pending_query_get_result finalizes.
+    struct PendingQueryState
+    {
+        duckdb::unique_ptr<duckdb::PendingQueryResult> pending;
+        std::string error_message;
+    };
+
+    extern "C" void *pending_query_create(
+        duckdb_connection c_conn,
+        const char *query,
+        uint64_t batch_size,
+        bool use_arrow_collector)
+    {
+        try
+        {
+            auto conn = get_cpp_connection(c_conn);
+            if (!conn)
+            {
+                return nullptr;
+            }
+
+            auto context = conn->context;
+            if (!context)
+            {
+                return nullptr;
+            }
+
+            auto state = std::make_unique<PendingQueryState>();
+
+            auto &config = duckdb::ClientConfig::GetConfig(*context);
+            auto original = config.get_result_collector;
+
+            try
+            {
+                if (use_arrow_collector)
+                {
+                    config.get_result_collector = [batch_size](
+                                                      duckdb::ClientContext &ctx,
+                                                      duckdb::PreparedStatementData &data) -> duckdb::PhysicalOperator &
+                    {
+                        return duckdb::PhysicalArrowCollector::Create(ctx, data, batch_size);
+                    };
+                }
+
+                query_generation_bump();
+                state->pending = conn->PendingQuery(query, false);
+
+                config.get_result_collector = original;
+            }
+            catch (...)
+            {
+                config.get_result_collector = original;
+                return nullptr;
+            }
+
+            if (!state->pending)
+            {
+                return nullptr;
+            }
+
+            return state.release();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    // Execute one unit of work on the pending query
+    // Returns: 0 = not ready (call again), 1 = result ready, 2 = error
+    extern "C" int pending_query_poll(void *state_ptr)
+    {
+        if (!state_ptr)
+        {
+            return 2;
+        }
+
+        auto *state = reinterpret_cast<PendingQueryState *>(state_ptr);
+
+        try
+        {
+            auto exec_result = state->pending->ExecuteTask();
+
+            switch (exec_result)
+            {
+            case duckdb::PendingExecutionResult::RESULT_READY:
+            case duckdb::PendingExecutionResult::EXECUTION_FINISHED:
+                return 1;
+            case duckdb::PendingExecutionResult::EXECUTION_ERROR:
+                state->error_message = state->pending->GetError();
+                return 2;
+            default:
+                // RESULT_NOT_READY / NO_TASKS_AVAILABLE / BLOCKED
+                return 0;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            state->error_message = e.what();
+            return 2;
+        }
+        catch (...)
+        {
+            state->error_message = "Unknown error while executing pending query";
+            return 2;
+        }
+    }
+
+    // Valid until the state is destroyed
+    extern "C" const char *pending_query_error(void *state_ptr)
+    {
+        if (!state_ptr)
+        {
+            return "Null pending query state";
+        }
+        auto *state = reinterpret_cast<PendingQueryState *>(state_ptr);
+        return state->error_message.c_str();
+    }
+
+    // Finalize the pending query - caller takes ownership of the result
+    extern "C" duckdb::QueryResult *pending_query_get_result(void *state_ptr)
+    {
+        if (!state_ptr)
+        {
+            return nullptr;
+        }
+
+        auto *state = reinterpret_cast<PendingQueryState *>(state_ptr);
+
+        try
+        {
+            auto result = state->pending->Execute();
+            return result.release();
+        }
+        catch (const std::exception &e)
+        {
+            state->error_message = e.what();
+            return nullptr;
+        }
+        catch (...)
+        {
+            state->error_message = "Unknown error finalizing pending query";
+            return nullptr;
+        }
+    }
+
+    extern "C" void pending_query_destroy(void *state_ptr)
+    {
+        if (state_ptr)
+        {
+            delete reinterpret_cast<PendingQueryState *>(state_ptr);
+        }
+    }
+
     extern "C" duckdb::ArrowQueryResult *cast_to_arrow_result(duckdb::QueryResult *result)
     {
         if (!result)
@@ -224,20 +625,62 @@ namespace bareduckdb
         return arrow_result->Arrays().size();
     }
 
-    // Consume and transfers ownership from the ArrowQueryResult to the caller
-    extern "C" void *arrow_result_consume_arrays(duckdb::ArrowQueryResult *arrow_result)
+    // Consumed materialized arrays plus the accounting charged for them;
+    // the charge is released in consumed_arrays_free
+    struct ConsumedArrays
+    {
+        duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>> arrays;
+        ConnectionMemoryAccounting *accounting = nullptr;
+        int64_t accounted_bytes = 0;
+    };
+
+    // Consume and transfers ownership from the ArrowQueryResult to the caller.
+    // With accounting attached the measured byte footprint is charged to the
+    // connection's result counter; a configured cap rejects the result here
+    // (null return, message via memory_accounting_last_error).
+    extern "C" void *arrow_result_consume_arrays(duckdb::ArrowQueryResult *arrow_result, void *accounting_ptr)
     {
         if (!arrow_result)
         {
             return nullptr;
         }
+        memory_limit_error().clear();
 
         try
         {
+            int64_t t0 = query_timing_start();
             auto arrays = arrow_result->ConsumeArrays();
 
-            auto *arrays_ptr = new duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>>(std::move(arrays));
-            return reinterpret_cast<void *>(arrays_ptr);
+            auto *holder = new ConsumedArrays();
+            holder->arrays = std::move(arrays);
+
+            auto *accounting = reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr);
+            if (accounting)
+            {
+                bool large_offsets =
+                    arrow_result->client_properties.arrow_offset_size == ArrowOffsetSize::LARGE;
+                int64_t bytes = 0;
+                for (auto &arr : holder->arrays)
+                {
+                    bytes += arrow_batch_bytes(arr->arrow_array, arrow_result->types, large_offsets);
+                }
+                if (accounting->WouldExceed(bytes))
+                {
+                    delete holder;
+                    memory_limit_error() =
+                        "Connection memory limit exceeded: materializing this result needs " +
+                        std::to_string(bytes) + " bytes on top of " +
+                        std::to_string(accounting->Total()) + " already held (limit " +
+                        std::to_string(accounting->limit_bytes.load(std::memory_order_relaxed)) +
+                        ")";
+                    return nullptr;
+                }
+                accounting->Add(accounting->result_bytes, bytes);
+                holder->accounting = accounting_retain(accounting);
+                holder->accounted_bytes = bytes;
+            }
+            query_timing_stop(t0, query_timing_state().collect_ns);
+            return reinterpret_cast<void *>(holder);
         }
         catch (...)
         {
@@ -251,8 +694,7 @@ namespace bareduckdb
         {
             return 0;
         }
-        auto *vec = reinterpret_cast<duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>> *>(arrays_ptr);
-        return vec->size();
+        return reinterpret_cast<ConsumedArrays *>(arrays_ptr)->arrays.size();
     }
 
     // Export array and schema at index from consumed arrays vector
@@ -269,7 +711,7 @@ namespace bareduckdb
             return false;
         }
 
-        auto *vec = reinterpret_cast<duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>> *>(arrays_ptr);
+        auto *vec = &reinterpret_cast<ConsumedArrays *>(arrays_ptr)->arrays;
         auto *arrow_result = reinterpret_cast<duckdb::ArrowQueryResult *>(arrow_result_ptr);
 
         if (index >= vec->size())
@@ -298,6 +740,93 @@ namespace bareduckdb
         }
     }
 
+    // Export only the ArrowArray at index - no per-batch schema rebuild
+    // Returns true on success, false on failure
+    extern "C" bool consumed_arrays_export_array_only(
+        void *arrays_ptr,
+        size_t index,
+        ArrowArray *out_array)
+    {
+        if (!arrays_ptr || !out_array)
+        {
+            return false;
+        }
+
+        auto *vec = &reinterpret_cast<ConsumedArrays *>(arrays_ptr)->arrays;
+        if (index >= vec->size())
+        {
+            return false;
+        }
+
+        // Transfer ownership of ArrowArray
+        int64_t t0 = query_timing_start();
+        *out_array = (*vec)[index]->arrow_array;
+        (*vec)[index]->arrow_array.release = nullptr;
+        if (t0)
+        {
+            auto &timings = query_timing_state();
+            query_timing_stop(t0, timings.array_export_ns);
+            timings.batches_exported++;
+            timings.rows_exported += out_array->length;
+        }
+        return true;
+    }
+
+    // Export ALL arrays in one call into a caller-provided buffer
+    // Avoids N C-call round trips and N schema conversions for wide tables
+    // Returns the number of arrays exported (0 on failure)
+    extern "C" size_t consumed_arrays_export_all(
+        void *arrays_ptr,
+        ArrowArray *out_arrays,
+        size_t max_arrays)
+    {
+        if (!arrays_ptr || !out_arrays)
+        {
+            return 0;
+        }
+
+        auto *vec = &reinterpret_cast<ConsumedArrays *>(arrays_ptr)->arrays;
+        if (vec->size() > max_arrays)
+        {
+            return 0;
+        }
+
+        int64_t t0 = query_timing_start();
+        for (size_t i = 0; i < vec->size(); i++)
+        {
+            // Transfer ownership of each ArrowArray to the caller
+            out_arrays[i] = (*vec)[i]->arrow_array;
+            (*vec)[i]->arrow_array.release = nullptr;
+        }
+        if (t0)
+        {
+            auto &timings = query_timing_state();
+            query_timing_stop(t0, timings.array_export_ns);
+            timings.batches_exported += static_cast<int64_t>(vec->size());
+            for (size_t i = 0; i < vec->size(); i++)
+            {
+                timings.rows_exported += out_arrays[i].length;
+            }
+        }
+        return vec->size();
+    }
+
+    // Release any arrays the caller still owns (cleanup on partial import failure)
+    extern "C" void release_exported_arrays(ArrowArray *arrays, size_t count)
+    {
+        if (!arrays)
+        {
+            return;
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            if (arrays[i].release)
+            {
+                arrays[i].release(&arrays[i]);
+            }
+        }
+    }
+
     // Export schema once / reuse
     // Returns true on success, false on failure
     extern "C" bool export_arrow_result_schema(
@@ -313,11 +842,13 @@ namespace bareduckdb
         {
             auto *arrow_result = reinterpret_cast<duckdb::ArrowQueryResult *>(arrow_result_ptr);
 
+            int64_t t0 = query_timing_start();
             duckdb::ArrowConverter::ToArrowSchema(
                 out_schema,
                 arrow_result->types,
                 arrow_result->names,
                 arrow_result->client_properties);
+            query_timing_stop(t0, query_timing_state().schema_export_ns);
 
             return true;
         }
@@ -327,14 +858,180 @@ namespace bareduckdb
         }
     }
 
-    // Free the consumed arrays vector
+    // Free the consumed arrays and release their accounting charge
     extern "C" void consumed_arrays_free(void *arrays_ptr)
     {
         if (arrays_ptr)
         {
-            auto *vec = reinterpret_cast<duckdb::vector<duckdb::unique_ptr<duckdb::ArrowArrayWrapper>> *>(arrays_ptr);
-            delete vec;
-        }
+            auto *holder = reinterpret_cast<ConsumedArrays *>(arrays_ptr);
+            if (holder->accounting)
+            {
+                if (holder->accounted_bytes > 0)
+                {
+                    holder->accounting->Sub(holder->accounting->result_bytes, holder->accounted_bytes);
+                }
+                accounting_release(holder->accounting);
+            }
+            delete holder;
+        }
+    }
+
+    // Direct columnar export: copy the collected Arrow buffers of a
+    // fixed-width column straight into one caller-allocated contiguous
+    // buffer, skipping the ArrowArray capsule -> pyarrow -> consumer hop.
+    // Only single-buffer fixed-width layouts participate (ints, floats,
+    // dates, times, timestamps); anything else reports kind 0 and the
+    // caller falls back to the Arrow path.
+    //
+    // Column kind codes (mapped to NumPy dtypes on the Python side)
+    enum NumpyExportKind
+    {
+        NUMPY_EXPORT_UNSUPPORTED = 0,
+        NUMPY_EXPORT_INT8 = 1,
+        NUMPY_EXPORT_INT16 = 2,
+        NUMPY_EXPORT_INT32 = 3,
+        NUMPY_EXPORT_INT64 = 4,
+        NUMPY_EXPORT_UINT8 = 5,
+        NUMPY_EXPORT_UINT16 = 6,
+        NUMPY_EXPORT_UINT32 = 7,
+        NUMPY_EXPORT_UINT64 = 8,
+        NUMPY_EXPORT_FLOAT32 = 9,
+        NUMPY_EXPORT_FLOAT64 = 10,
+        NUMPY_EXPORT_DATE32 = 11,
+        NUMPY_EXPORT_TIMESTAMP_S = 12,
+        NUMPY_EXPORT_TIMESTAMP_MS = 13,
+        NUMPY_EXPORT_TIMESTAMP_US = 14,
+        NUMPY_EXPORT_TIMESTAMP_NS = 15,
+        NUMPY_EXPORT_TIME64_US = 16,
+    };
+
+    extern "C" int64_t numpy_export_num_columns(const ArrowSchema *schema)
+    {
+        return schema ? schema->n_children : 0;
+    }
+
+    extern "C" const char *numpy_export_column_name(const ArrowSchema *schema, size_t col)
+    {
+        if (!schema || static_cast<int64_t>(col) >= schema->n_children)
+        {
+            return nullptr;
+        }
+        return schema->children[col]->name;
+    }
+
+    // Classify a column by its Arrow format string; out_width gets the
+    // storage width in bytes (0 when unsupported)
+    extern "C" int numpy_export_column_kind(const ArrowSchema *schema, size_t col, int64_t *out_width)
+    {
+        *out_width = 0;
+        if (!schema || static_cast<int64_t>(col) >= schema->n_children)
+        {
+            return NUMPY_EXPORT_UNSUPPORTED;
+        }
+        const char *fmt = schema->children[col]->format;
+        if (!fmt)
+        {
+            return NUMPY_EXPORT_UNSUPPORTED;
+        }
+
+        if (fmt[0] != '\0' && fmt[1] == '\0')
+        {
+            switch (fmt[0])
+            {
+            case 'c': *out_width = 1; return NUMPY_EXPORT_INT8;
+            case 'C': *out_width = 1; return NUMPY_EXPORT_UINT8;
+            case 's': *out_width = 2; return NUMPY_EXPORT_INT16;
+            case 'S': *out_width = 2; return NUMPY_EXPORT_UINT16;
+            case 'i': *out_width = 4; return NUMPY_EXPORT_INT32;
+            case 'I': *out_width = 4; return NUMPY_EXPORT_UINT32;
+            case 'l': *out_width = 8; return NUMPY_EXPORT_INT64;
+            case 'L': *out_width = 8; return NUMPY_EXPORT_UINT64;
+            case 'f': *out_width = 4; return NUMPY_EXPORT_FLOAT32;
+            case 'g': *out_width = 8; return NUMPY_EXPORT_FLOAT64;
+            default: return NUMPY_EXPORT_UNSUPPORTED;
+            }
+        }
+
+        // Timezone-naive timestamps only ("tsu:" with nothing after the
+        // colon) - tz-aware values don't map cleanly onto datetime64
+        if (std::strcmp(fmt, "tss:") == 0) { *out_width = 8; return NUMPY_EXPORT_TIMESTAMP_S; }
+        if (std::strcmp(fmt, "tsm:") == 0) { *out_width = 8; return NUMPY_EXPORT_TIMESTAMP_MS; }
+        if (std::strcmp(fmt, "tsu:") == 0) { *out_width = 8; return NUMPY_EXPORT_TIMESTAMP_US; }
+        if (std::strcmp(fmt, "tsn:") == 0) { *out_width = 8; return NUMPY_EXPORT_TIMESTAMP_NS; }
+        if (std::strcmp(fmt, "tdD") == 0) { *out_width = 4; return NUMPY_EXPORT_DATE32; }
+        if (std::strcmp(fmt, "ttu") == 0) { *out_width = 8; return NUMPY_EXPORT_TIME64_US; }
+
+        return NUMPY_EXPORT_UNSUPPORTED;
+    }
+
+    extern "C" int64_t numpy_export_total_rows(const ArrowArray *arrays, size_t num_arrays)
+    {
+        int64_t total = 0;
+        for (size_t i = 0; i < num_arrays; i++)
+        {
+            total += arrays[i].length;
+        }
+        return total;
+    }
+
+    // Copy one fixed-width column across all batches into dest, and expand
+    // validity bitmaps into one byte per row (1 = valid) in validity_out.
+    // Returns the number of nulls seen, or -1 on layout mismatch.
+    extern "C" int64_t numpy_export_copy_column(
+        const ArrowArray *arrays,
+        size_t num_arrays,
+        size_t col,
+        int64_t width,
+        void *dest,
+        uint8_t *validity_out)
+    {
+        uint8_t *dest_bytes = static_cast<uint8_t *>(dest);
+        int64_t row_cursor = 0;
+        int64_t null_count = 0;
+
+        for (size_t i = 0; i < num_arrays; i++)
+        {
+            if (static_cast<int64_t>(col) >= arrays[i].n_children)
+            {
+                return -1;
+            }
+            const ArrowArray *child = arrays[i].children[col];
+            const int64_t length = arrays[i].length;
+            if (!child->buffers || child->n_buffers < 2 || !child->buffers[1])
+            {
+                return -1;
+            }
+
+            const uint8_t *src = static_cast<const uint8_t *>(child->buffers[1]) + child->offset * width;
+            std::memcpy(dest_bytes + row_cursor * width, src, static_cast<size_t>(length) * width);
+
+            const uint8_t *validity = static_cast<const uint8_t *>(child->buffers[0]);
+            if (child->null_count != 0 && validity)
+            {
+                for (int64_t row = 0; row < length; row++)
+                {
+                    const int64_t bit = child->offset + row;
+                    const uint8_t valid = (validity[bit >> 3] >> (bit & 7)) & 1;
+                    validity_out[row_cursor + row] = valid;
+                    null_count += valid ? 0 : 1;
+                }
+            }
+            else
+            {
+                std::memset(validity_out + row_cursor, 1, static_cast<size_t>(length));
+            }
+            row_cursor += length;
+        }
+        return null_count;
+    }
+
+    // Release an ArrowSchema the caller exported but did not hand to pyarrow
+    extern "C" void release_arrow_schema(ArrowSchema *schema)
+    {
+        if (schema && schema->release)
+        {
+            schema->release(schema);
+        }
     }
 
     struct StreamingArrowState
@@ -555,15 +1252,144 @@ namespace bareduckdb
     }
 
     // Streaming ArrowArrayStream Wrapper using QueryResultChunkScanState
+    // Measured byte footprint of one exported column, counting validity,
+    // offset and data buffers. Variable-width columns are sized from the
+    // offsets actually produced, so a wide-string result is measured from
+    // real data rather than a type-width guess. Returns -1 for layouts this
+    // walker doesn't understand (the caller then skips adaptation).
+    inline int64_t arrow_column_bytes(
+        const ArrowArray *col,
+        const LogicalType &type,
+        bool large_offsets)
+    {
+        if (!col || !col->buffers)
+        {
+            return -1;
+        }
+
+        int64_t rows = col->length;
+        int64_t bytes = 0;
+        if (col->n_buffers > 0 && col->buffers[0])
+        {
+            bytes += (rows + 7) / 8;
+        }
+
+        switch (type.id())
+        {
+        case LogicalTypeId::VARCHAR:
+        case LogicalTypeId::BLOB:
+        case LogicalTypeId::BIT:
+        {
+            if (col->n_buffers < 3 || !col->buffers[1])
+            {
+                // e.g. string-view layout - not worth special-casing here
+                return -1;
+            }
+            if (large_offsets)
+            {
+                auto *offsets = reinterpret_cast<const int64_t *>(col->buffers[1]);
+                bytes += (rows + 1) * 8 + (offsets[col->offset + rows] - offsets[col->offset]);
+            }
+            else
+            {
+                auto *offsets = reinterpret_cast<const int32_t *>(col->buffers[1]);
+                bytes += (rows + 1) * 4 + (offsets[col->offset + rows] - offsets[col->offset]);
+            }
+            break;
+        }
+        case LogicalTypeId::LIST:
+        {
+            if (col->n_buffers < 2 || col->n_children < 1)
+            {
+                return -1;
+            }
+            int64_t child = arrow_column_bytes(
+                col->children[0], ListType::GetChildType(type), large_offsets);
+            if (child < 0)
+            {
+                return -1;
+            }
+            bytes += (rows + 1) * (large_offsets ? 8 : 4) + child;
+            break;
+        }
+        case LogicalTypeId::STRUCT:
+        {
+            auto &child_types = StructType::GetChildTypes(type);
+            if (col->n_children != static_cast<int64_t>(child_types.size()))
+            {
+                return -1;
+            }
+            for (int64_t i = 0; i < col->n_children; i++)
+            {
+                int64_t child = arrow_column_bytes(
+                    col->children[i], child_types[i].second, large_offsets);
+                if (child < 0)
+                {
+                    return -1;
+                }
+                bytes += child;
+            }
+            break;
+        }
+        default:
+        {
+            auto physical = type.InternalType();
+            if (!TypeIsConstantSize(physical))
+            {
+                return -1;
+            }
+            bytes += rows * static_cast<int64_t>(GetTypeIdSize(physical));
+            break;
+        }
+        }
+        return bytes;
+    }
+
+    // Measured footprint of a whole exported batch for memory accounting.
+    // Unlike the adaptive-batch sizing above, unmeasurable columns count as
+    // zero rather than poisoning the batch: accounting prefers a floor
+    // estimate over giving up entirely.
+    inline int64_t arrow_batch_bytes(
+        const ArrowArray &batch,
+        const duckdb::vector<duckdb::LogicalType> &types,
+        bool large_offsets)
+    {
+        if (batch.n_children != static_cast<int64_t>(types.size()) || !batch.children)
+        {
+            return 0;
+        }
+        int64_t bytes = 0;
+        for (int64_t i = 0; i < batch.n_children; i++)
+        {
+            int64_t col = arrow_column_bytes(batch.children[i], types[i], large_offsets);
+            if (col > 0)
+            {
+                bytes += col;
+            }
+        }
+        return bytes;
+    }
+
     struct StreamingArrowArrayStreamWrapper
     {
+        // Adaptive rows_per_batch stays within these bounds: never below one
+        // DuckDB-vector-ish chunk, never above what a single ArrowAppender
+        // run handles comfortably
+        static constexpr uint64_t ADAPTIVE_MIN_ROWS = 2048;
+        static constexpr uint64_t ADAPTIVE_MAX_ROWS = 8388608;
+
         uint64_t creating_query_number = 0; // for deadlock detection, when consumed recursively
+        uint64_t creating_generation = 0;   // query_generation() at creation - fast-path guard
         QueryResultChunkScanState scan_state;
         QueryResult *result;
         uint64_t rows_per_batch;
+        uint64_t target_batch_bytes = 0; // nonzero enables adaptive batch sizing
+        bool row_bytes_measured = false;
         ArrowSchema schema;
         bool schema_exported = false;
         string last_error;
+        ConnectionMemoryAccounting *accounting = nullptr; // optional, owned by the connection
+        int64_t last_batch_bytes = 0;                     // charge held for the batch in flight
 
         StreamingArrowArrayStreamWrapper(QueryResult *res, uint64_t batch_size)
             : scan_state(*res), result(res), rows_per_batch(batch_size)
@@ -578,6 +1404,19 @@ namespace bareduckdb
             {
                 creating_query_number = 0;
             }
+            creating_generation = query_generation().load(std::memory_order_relaxed);
+        }
+
+        ~StreamingArrowArrayStreamWrapper()
+        {
+            if (accounting)
+            {
+                if (last_batch_bytes > 0)
+                {
+                    accounting->Sub(accounting->stream_bytes, last_batch_bytes);
+                }
+                accounting_release(accounting);
+            }
         }
 
         static int GetSchema(ArrowArrayStream *stream, ArrowSchema *out)
@@ -634,8 +1473,13 @@ namespace bareduckdb
                 return -1;
             }
 
-            // DEADLOCK DETECTION: Check if we're being called from a different query than the one that created us
-            if (wrapper->creating_query_number != 0 && wrapper->result->client_properties.client_context)
+            // DEADLOCK DETECTION: Check if we're being called from a different query than the one that created us.
+            // Fast path: the module-wide generation counter only changes when a
+            // query starts, so an unchanged value means no nesting is possible
+            // and the DatabaseManager lookup is skipped (one relaxed load in
+            // the per-batch inner loop).
+            if (wrapper->creating_query_number != 0 && wrapper->result->client_properties.client_context &&
+                query_generation().load(std::memory_order_relaxed) != wrapper->creating_generation)
             {
                 auto *ctx = wrapper->result->client_properties.client_context.get();
                 uint64_t current_query_number = ctx->db->GetDatabaseManager().ActiveQueryNumber();
@@ -646,6 +1490,8 @@ namespace bareduckdb
                         "Deadlock detected: Cannot read from streaming Arrow reader during a different query.\n";
                     return -1;
                 }
+                // Still inside the creating query - re-arm the fast path
+                wrapper->creating_generation = query_generation().load(std::memory_order_relaxed);
             }
 
             try
@@ -660,6 +1506,16 @@ namespace bareduckdb
                         *wrapper->result->client_properties.client_context,
                         wrapper->result->types));
 
+                // The previous batch has been handed off to the consumer by
+                // now, so its in-flight charge is released here regardless of
+                // whether another batch follows
+                if (wrapper->accounting && wrapper->last_batch_bytes > 0)
+                {
+                    wrapper->accounting->Sub(wrapper->accounting->stream_bytes,
+                                             wrapper->last_batch_bytes);
+                    wrapper->last_batch_bytes = 0;
+                }
+
                 if (count == 0)
                 {
                     // Signal end of stream
@@ -667,6 +1523,66 @@ namespace bareduckdb
                     return 0;
                 }
 
+                // Adaptive sizing: measure bytes-per-row once from the first
+                // fetched chunk, then resize subsequent requests toward the
+                // target byte footprint. Narrow-int and wide-string results
+                // then stream at comparable batch sizes without per-query
+                // tuning; unmeasurable layouts keep the caller's batch size.
+                if (wrapper->target_batch_bytes != 0 && !wrapper->row_bytes_measured)
+                {
+                    wrapper->row_bytes_measured = true;
+                    auto &types = wrapper->result->types;
+                    bool large_offsets =
+                        wrapper->result->client_properties.arrow_offset_size == ArrowOffsetSize::LARGE;
+                    if (data.n_children == static_cast<int64_t>(types.size()))
+                    {
+                        int64_t total_bytes = 0;
+                        for (size_t i = 0; i < types.size(); i++)
+                        {
+                            int64_t col_bytes = arrow_column_bytes(
+                                data.children[i], types[i], large_offsets);
+                            if (col_bytes < 0)
+                            {
+                                total_bytes = -1;
+                                break;
+                            }
+                            total_bytes += col_bytes;
+                        }
+                        if (total_bytes > 0)
+                        {
+                            uint64_t bytes_per_row =
+                                std::max<uint64_t>(1, static_cast<uint64_t>(total_bytes) / count);
+                            wrapper->rows_per_batch = std::min(
+                                std::max(wrapper->target_batch_bytes / bytes_per_row, ADAPTIVE_MIN_ROWS),
+                                ADAPTIVE_MAX_ROWS);
+                        }
+                    }
+                }
+
+                if (wrapper->accounting)
+                {
+                    bool large_offsets =
+                        wrapper->result->client_properties.arrow_offset_size == ArrowOffsetSize::LARGE;
+                    int64_t batch_bytes =
+                        arrow_batch_bytes(data, wrapper->result->types, large_offsets);
+                    if (wrapper->accounting->WouldExceed(batch_bytes))
+                    {
+                        if (data.release)
+                        {
+                            data.release(&data);
+                        }
+                        wrapper->last_error =
+                            "Connection memory limit exceeded while streaming: next batch needs " +
+                            std::to_string(batch_bytes) + " bytes on top of " +
+                            std::to_string(wrapper->accounting->Total()) + " already held (limit " +
+                            std::to_string(wrapper->accounting->limit_bytes.load(std::memory_order_relaxed)) +
+                            ")";
+                        return -1;
+                    }
+                    wrapper->accounting->Add(wrapper->accounting->stream_bytes, batch_bytes);
+                    wrapper->last_batch_bytes = batch_bytes;
+                }
+
                 *out = data;
                 return 0;
             }
@@ -745,429 +1661,1778 @@ namespace bareduckdb
         }
     }
 
-    struct ErrorStreamWrapper
+    // Adaptive variant: starts at initial_rows_per_batch, measures bytes per
+    // row from the first fetched chunk and resizes later chunk requests to
+    // land near target_batch_bytes per batch. The fixed-size entry point
+    // above stays as-is for callers that tuned a batch size themselves.
+    extern "C" void *create_streaming_arrow_array_stream_adaptive(
+        QueryResult *result,
+        uint64_t initial_rows_per_batch,
+        uint64_t target_batch_bytes)
     {
-        std::string error_message;
-        ArrowSchemaWrapper cached_schema;
-        bool schema_cached = false;
-
-        explicit ErrorStreamWrapper(const std::string &msg, const ArrowSchema &schema)
-            : error_message(msg)
+        auto *stream = static_cast<ArrowArrayStream *>(
+            create_streaming_arrow_array_stream(result, initial_rows_per_batch));
+        if (stream && target_batch_bytes != 0)
         {
-            cached_schema.arrow_schema = schema;
-            cached_schema.arrow_schema.release = nullptr; // Don't free, we're borrowing
-            schema_cached = true;
+            auto *wrapper =
+                reinterpret_cast<StreamingArrowArrayStreamWrapper *>(stream->private_data);
+            wrapper->target_batch_bytes = target_batch_bytes;
         }
+        return stream;
+    }
 
-        static int error_get_schema(ArrowArrayStream *stream, ArrowSchema *out)
+    // Attach connection accounting to a streaming wrapper after creation so
+    // both stream entry points above pick it up without signature churn
+    extern "C" void streaming_stream_set_accounting(void *stream_ptr, void *accounting_ptr)
+    {
+        auto *stream = static_cast<ArrowArrayStream *>(stream_ptr);
+        if (!stream || !stream->private_data ||
+            stream->get_next != StreamingArrowArrayStreamWrapper::GetNext)
         {
-            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
-            if (wrapper->schema_cached)
-            {
-                *out = wrapper->cached_schema.arrow_schema;
-                out->release = nullptr; // Don't let caller free it
-                return 0;
-            }
-            return -1;
+            return;
         }
-
-        static int error_get_next(ArrowArrayStream *stream, ArrowArray *out)
+        auto *wrapper = reinterpret_cast<StreamingArrowArrayStreamWrapper *>(stream->private_data);
+        if (!wrapper->accounting)
         {
-            out->release = nullptr; // Signal end-of-stream
-            return -1;
+            wrapper->accounting =
+                accounting_retain(reinterpret_cast<ConnectionMemoryAccounting *>(accounting_ptr));
         }
+    }
 
-        static const char *error_get_last_error(ArrowArrayStream *stream)
-        {
-            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
-            return wrapper->error_message.c_str();
-        }
+    // Prefetching streaming wrapper: a background thread runs FetchChunk ahead
+    // of the consumer into a bounded queue, overlapping DuckDB execution with
+    // Python-side consumption (double buffering for ETL-style streaming)
+    struct PrefetchingArrowArrayStreamWrapper
+    {
+        // Small on purpose - one batch being consumed, QUEUE_CAPACITY ready,
+        // one being fetched. Larger values just raise peak memory.
+        static constexpr size_t QUEUE_CAPACITY = 2;
 
-        static void error_release(ArrowArrayStream *stream)
-        {
-            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
-            delete wrapper;
-            stream->release = nullptr;
-        }
-    };
+        uint64_t creating_query_number = 0; // for deadlock detection, when consumed recursively
+        uint64_t creating_generation = 0;   // query_generation() at creation - fast-path guard
+        QueryResultChunkScanState scan_state;
+        QueryResult *result;
+        uint64_t rows_per_batch;
+        ArrowSchema schema;
+        bool schema_exported = false;
+        string last_error;
 
-    // Single-use stream wrapper - Wraps an ArrowArrayStream to detect and prevent reuse
-    // Experimental idea - add some safety to prevent reuse of capsules / readers that have
-    // been exhausted
-    struct SingleUseStreamWrapper
-    {
-        ArrowArrayStream *underlying_stream;
-        bool consumed = false;
-        bool started = false;
-        std::string error_message;
-        std::mutex mutex;               // EXPERIMENTAL Bugfix: Serialize access to prevent concurrent get_next() calls
-        uint64_t creating_query_number; // Deadlock detection
+        std::mutex mutex;
+        std::condition_variable not_empty;
+        std::condition_variable not_full;
+        std::deque<ArrowArray> queue;
+        bool producer_done = false;
+        bool producer_error = false;
+        bool shutdown = false;
+        std::thread producer;
 
-        static bool use_mutex()
+        PrefetchingArrowArrayStreamWrapper(QueryResult *res, uint64_t batch_size)
+            : scan_state(*res), result(res), rows_per_batch(batch_size)
         {
-            static bool enabled = []()
+            if (res->client_properties.client_context)
             {
-                const char *env = std::getenv("BAREDUCKDB_STREAM_MUTEX");
-                return !(env && std::string(env) == "0");
-            }();
-            return enabled;
+                auto *ctx = res->client_properties.client_context.get();
+                creating_query_number = ctx->db->GetDatabaseManager().ActiveQueryNumber();
+            }
+            creating_generation = query_generation().load(std::memory_order_relaxed);
         }
 
-        static int wrapped_get_schema(ArrowArrayStream *stream, ArrowSchema *out)
+        ~PrefetchingArrowArrayStreamWrapper()
         {
-            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
-
-            // TODO: Decide if needed... this was during debugging
-            if (!wrapper->underlying_stream || !wrapper->underlying_stream->get_schema)
             {
-                wrapper->error_message =
-                    "Arrow stream is invalid. Capsule may have been garbage collected";
-                return -1;
+                std::lock_guard<std::mutex> lock(mutex);
+                shutdown = true;
             }
-
-            return wrapper->underlying_stream->get_schema(wrapper->underlying_stream, out);
-        }
-
-        static int wrapped_get_next(ArrowArrayStream *stream, ArrowArray *out)
-        {
-            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
-
-            // EXPERIMENTAL: Lock to serialize access from DuckDB's parallel threads
-            // This reduces race conditions when arrow_reader() triggers lazy execution
-            std::unique_lock<std::mutex> lock(wrapper->mutex, std::defer_lock);
-            if (use_mutex())
+            not_full.notify_all();
+            if (producer.joinable())
             {
-                lock.lock();
+                producer.join();
             }
 
-            // DEFENSIVE CHECK: Validate stream pointer before dereferencing
-            // This can happen if the PyCapsule was garbage collected while still in use
-            if (!wrapper->underlying_stream || !wrapper->underlying_stream->get_next)
+            for (auto &array : queue)
             {
-                wrapper->error_message =
-                    "Arrow stream is invalid. Capsule may have been garbage collected";
-                return -1;
+                if (array.release)
+                {
+                    array.release(&array);
+                }
             }
+        }
 
-            int result = wrapper->underlying_stream->get_next(wrapper->underlying_stream, out);
-
-            return result;
+        void Start()
+        {
+            producer = std::thread(&PrefetchingArrowArrayStreamWrapper::ProducerLoop, this);
         }
 
-        static const char *wrapped_get_last_error(ArrowArrayStream *stream)
+        void ProducerLoop()
         {
-            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
-            std::unique_lock<std::mutex> lock(wrapper->mutex, std::defer_lock);
-            if (use_mutex())
-            {
-                lock.lock();
-            }
-            if (!wrapper->error_message.empty())
+            for (;;)
             {
-                return wrapper->error_message.c_str();
+                ArrowArray data;
+                uint64_t count;
+
+                try
+                {
+                    count = ArrowUtil::FetchChunk(
+                        scan_state,
+                        result->client_properties,
+                        rows_per_batch,
+                        &data,
+                        ArrowTypeExtensionData::GetExtensionTypes(
+                            *result->client_properties.client_context,
+                            result->types));
+                }
+                catch (const std::exception &e)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    last_error = e.what();
+                    producer_error = true;
+                    producer_done = true;
+                    not_empty.notify_all();
+                    return;
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    last_error = "Unknown error while prefetching chunk";
+                    producer_error = true;
+                    producer_done = true;
+                    not_empty.notify_all();
+                    return;
+                }
+
+                std::unique_lock<std::mutex> lock(mutex);
+
+                if (count == 0)
+                {
+                    producer_done = true;
+                    not_empty.notify_all();
+                    return;
+                }
+
+                not_full.wait(lock, [this]
+                              { return queue.size() < QUEUE_CAPACITY || shutdown; });
+
+                if (shutdown)
+                {
+                    lock.unlock();
+                    if (data.release)
+                    {
+                        data.release(&data);
+                    }
+                    return;
+                }
+
+                queue.push_back(data);
+                not_empty.notify_all();
             }
-            return wrapper->underlying_stream->get_last_error(wrapper->underlying_stream);
         }
 
-        static void wrapped_release(ArrowArrayStream *stream)
+        static int GetSchema(ArrowArrayStream *stream, ArrowSchema *out)
         {
-            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
+            if (!stream || !out)
+            {
+                return -1;
+            }
+            auto wrapper = reinterpret_cast<PrefetchingArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper)
+            {
+                return -1;
+            }
 
-            if (wrapper->underlying_stream && wrapper->underlying_stream->release)
+            try
             {
-                auto release_fn = wrapper->underlying_stream->release;
-                auto *underlying = wrapper->underlying_stream;
+                if (wrapper->schema_exported)
+                {
+                    ArrowConverter::ToArrowSchema(
+                        out,
+                        wrapper->result->types,
+                        wrapper->result->names,
+                        wrapper->result->client_properties);
+                }
+                else
+                {
+                    *out = wrapper->schema;
+                    wrapper->schema.release = nullptr;
+                    wrapper->schema_exported = true;
+                }
+                return 0;
+            }
+            catch (const std::exception &e)
+            {
+                wrapper->last_error = e.what();
+                return -1;
+            }
+            catch (...)
+            {
+                wrapper->last_error = "Unknown error in GetSchema";
+                return -1;
+            }
+        }
 
-                wrapper->underlying_stream = nullptr;
+        static int GetNext(ArrowArrayStream *stream, ArrowArray *out)
+        {
+            if (!stream || !out)
+            {
+                return -1;
+            }
+            auto wrapper = reinterpret_cast<PrefetchingArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper)
+            {
+                return -1;
+            }
 
-                release_fn(underlying);
+            // DEADLOCK DETECTION: Check if we're being called from a different query than the one that created us.
+            // Same generation-counter fast path as the plain streaming wrapper:
+            // the DatabaseManager lookup only runs when a query has started
+            // since this stream was created (or last checked).
+            if (wrapper->creating_query_number != 0 && wrapper->result->client_properties.client_context &&
+                query_generation().load(std::memory_order_relaxed) != wrapper->creating_generation)
+            {
+                auto *ctx = wrapper->result->client_properties.client_context.get();
+                uint64_t current_query_number = ctx->db->GetDatabaseManager().ActiveQueryNumber();
+
+                if (wrapper->creating_query_number != current_query_number)
+                {
+                    wrapper->last_error =
+                        "Deadlock detected: Cannot read from streaming Arrow reader during a different query.\n";
+                    return -1;
+                }
+                // Still inside the creating query - re-arm the fast path
+                wrapper->creating_generation = query_generation().load(std::memory_order_relaxed);
             }
 
-            delete wrapper;
+            std::unique_lock<std::mutex> lock(wrapper->mutex);
+            wrapper->not_empty.wait(lock, [wrapper]
+                                    { return !wrapper->queue.empty() || wrapper->producer_done; });
+
+            if (!wrapper->queue.empty())
+            {
+                *out = wrapper->queue.front();
+                wrapper->queue.pop_front();
+                wrapper->not_full.notify_all();
+                return 0;
+            }
+
+            if (wrapper->producer_error)
+            {
+                return -1;
+            }
+
+            // Signal end of stream
+            out->release = nullptr;
+            return 0;
+        }
+
+        static void Release(ArrowArrayStream *stream)
+        {
+            if (!stream || !stream->release)
+            {
+                return;
+            }
             stream->release = nullptr;
+            delete reinterpret_cast<PrefetchingArrowArrayStreamWrapper *>(stream->private_data);
         }
-    };
 
-    // Store ArrowArrayStream* directly
-    namespace RawStreamCallbacks
-    {
-        // Note: These functions are reserved for future raw stream support
-        // Currently unused but kept for potential stream registration feature
-        [[maybe_unused]] static void GetSchema(uintptr_t factory_ptr, ArrowSchema &schema)
+        static const char *GetLastError(ArrowArrayStream *stream)
         {
-            auto *stream = reinterpret_cast<ArrowArrayStream *>(factory_ptr);
-            int result = stream->get_schema(stream, &schema);
-            if (result != 0)
+            if (!stream)
             {
-                throw std::runtime_error("Failed to get schema from raw arrow stream");
+                return nullptr;
             }
+            auto wrapper = reinterpret_cast<PrefetchingArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper || wrapper->last_error.empty())
+            {
+                return nullptr;
+            }
+            return wrapper->last_error.c_str();
         }
+    };
 
-        [[maybe_unused]] static duckdb::unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(uintptr_t factory_ptr, ArrowStreamParameters &params)
+    // Create prefetching streaming ArrowArrayStream from QueryResult
+    // Returns heap-allocated ArrowArrayStream pointer
+    // Returns nullptr on error
+    extern "C" void *create_prefetching_arrow_array_stream(
+        QueryResult *result,
+        uint64_t rows_per_batch)
+    {
+        if (!result)
         {
-            auto *stream = reinterpret_cast<ArrowArrayStream *>(factory_ptr);
-            auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
-            wrapper->arrow_array_stream = *stream;
-            stream->release = nullptr;
-            return wrapper;
+            return nullptr;
+        }
+
+        try
+        {
+            auto *stream = new ArrowArrayStream();
+
+            auto *wrapper = new PrefetchingArrowArrayStreamWrapper(result, rows_per_batch);
+
+            ArrowConverter::ToArrowSchema(
+                &wrapper->schema,
+                result->types,
+                result->names,
+                result->client_properties);
+
+            stream->private_data = wrapper;
+            stream->get_schema = PrefetchingArrowArrayStreamWrapper::GetSchema;
+            stream->get_next = PrefetchingArrowArrayStreamWrapper::GetNext;
+            stream->release = PrefetchingArrowArrayStreamWrapper::Release;
+            stream->get_last_error = PrefetchingArrowArrayStreamWrapper::GetLastError;
+
+            wrapper->Start();
+
+            return stream;
+        }
+        catch (...)
+        {
+            return nullptr;
         }
     }
 
-    struct CapsuleArrowStreamFactory
+    // Parallel chunk->Arrow conversion for materialized results. The chunks
+    // of a MaterializedQueryResult are independent, but the serial scan path
+    // converts them on one core while the conversion (ArrowAppender, VARCHAR
+    // copies) dominates wide results. Here the chunk list is partitioned into
+    // rows_per_batch-sized tasks and a small worker pool converts them
+    // concurrently, each worker claiming the next unclaimed task (dynamic
+    // scheduling, so a slow wide batch doesn't stall the rest). Output is
+    // indexed by task, so the stream emits batches in their original order.
+    // Everything is converted before the stream is returned and the DuckDB
+    // result is freed immediately afterwards - GetNext never touches the
+    // ClientContext, so no recursive-query deadlock is possible.
+    struct ParallelArrowArrayStreamWrapper
     {
-        duckdb::ArrowArrayStreamWrapper stream;
-        ArrowSchemaWrapper cached_schema;
-        int64_t cardinality;
-        std::atomic<bool> produced{false};
-        uint64_t creating_query_number; // Deadlock Detection
+        std::vector<ArrowArray> arrays;
+        size_t current_idx = 0;
+        ArrowSchema schema {};
+        bool schema_exported = false;
+        string last_error;
 
-        explicit CapsuleArrowStreamFactory(ArrowArrayStream *source_stream, int64_t cardinality_p = -1, uint64_t query_num = 0)
-            : cardinality(cardinality_p), creating_query_number(query_num)
+        ~ParallelArrowArrayStreamWrapper()
         {
-            stream.arrow_array_stream = *source_stream;
-            source_stream->release = nullptr;
-
-            int result = stream.arrow_array_stream.get_schema(&stream.arrow_array_stream, &cached_schema.arrow_schema);
-            if (result != 0)
+            for (size_t i = current_idx; i < arrays.size(); i++)
             {
-                throw std::runtime_error("Failed to get schema from capsule stream");
+                if (arrays[i].release)
+                {
+                    arrays[i].release(&arrays[i]);
+                }
+            }
+            if (!schema_exported && schema.release)
+            {
+                schema.release(&schema);
             }
         }
 
-        static void GetSchema(uintptr_t factory_ptr, ArrowSchema &schema)
+        static int GetSchema(ArrowArrayStream *stream, ArrowSchema *out)
         {
-            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
-            schema = factory->cached_schema.arrow_schema;
-            schema.release = nullptr;
+            if (!stream || !out)
+            {
+                return -1;
+            }
+            auto wrapper = reinterpret_cast<ParallelArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper || wrapper->schema_exported)
+            {
+                return -1;
+            }
+
+            *out = wrapper->schema;
+            wrapper->schema.release = nullptr;
+            wrapper->schema_exported = true;
+            return 0;
         }
 
-        static duckdb::unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(uintptr_t factory_ptr, ArrowStreamParameters &params)
+        static int GetNext(ArrowArrayStream *stream, ArrowArray *out)
         {
-            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+            if (!stream || !out)
+            {
+                return -1;
+            }
+            auto wrapper = reinterpret_cast<ParallelArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper)
+            {
+                return -1;
+            }
 
-            bool expected = false;
-            if (!factory->produced.compare_exchange_strong(expected, true))
+            if (wrapper->current_idx >= wrapper->arrays.size())
             {
-                auto error_wrapper_ptr = new ErrorStreamWrapper(
-                    "Arrow stream has already been consumed",
-                    factory->cached_schema.arrow_schema);
+                // Signal end of stream
+                out->release = nullptr;
+                return 0;
+            }
 
-                auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
-                wrapper->arrow_array_stream.get_schema = ErrorStreamWrapper::error_get_schema;
-                wrapper->arrow_array_stream.get_next = ErrorStreamWrapper::error_get_next;
-                wrapper->arrow_array_stream.get_last_error = ErrorStreamWrapper::error_get_last_error;
-                wrapper->arrow_array_stream.release = ErrorStreamWrapper::error_release;
-                wrapper->arrow_array_stream.private_data = error_wrapper_ptr;
+            *out = wrapper->arrays[wrapper->current_idx];
+            wrapper->arrays[wrapper->current_idx].release = nullptr;
+            wrapper->current_idx++;
+            return 0;
+        }
 
-                return wrapper;
+        static void Release(ArrowArrayStream *stream)
+        {
+            if (!stream || !stream->release)
+            {
+                return;
             }
+            stream->release = nullptr;
+            delete reinterpret_cast<ParallelArrowArrayStreamWrapper *>(stream->private_data);
+        }
 
-            auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
-            wrapper->arrow_array_stream = factory->stream.arrow_array_stream;
+        static const char *GetLastError(ArrowArrayStream *stream)
+        {
+            if (!stream)
+            {
+                return nullptr;
+            }
+            auto wrapper = reinterpret_cast<ParallelArrowArrayStreamWrapper *>(stream->private_data);
+            if (!wrapper || wrapper->last_error.empty())
+            {
+                return nullptr;
+            }
+            return wrapper->last_error.c_str();
+        }
+    };
 
-            factory->stream.arrow_array_stream.release = nullptr;
+    // Message describing the last parallel-conversion failure on this
+    // thread - the creator below can only return nullptr, so the real
+    // cause (e.g. an allocator failure in ArrowAppender) is parked here
+    // for the caller to raise. Same pattern as memory_accounting_last_error.
+    inline std::string &parallel_stream_error()
+    {
+        static thread_local std::string err;
+        return err;
+    }
 
-            return wrapper;
-        }
+    extern "C" const char *parallel_stream_last_error()
+    {
+        auto &err = parallel_stream_error();
+        return err.empty() ? nullptr : err.c_str();
+    }
+
+    // Create an ArrowArrayStream from a MaterializedQueryResult with the
+    // chunk->Arrow conversion spread across a worker pool. Takes ownership
+    // of the result and frees it before returning. Returns nullptr on error
+    // (including when the result is not materialized), with the cause
+    // available through parallel_stream_last_error.
+    extern "C" void *create_parallel_arrow_array_stream(
+        QueryResult *result,
+        uint64_t rows_per_batch)
+    {
+        parallel_stream_error().clear();
+
+        // Own the result before any early return - the caller hands over
+        // ownership unconditionally, including on failure
+        duckdb::unique_ptr<QueryResult> owned_result(result);
+
+        if (!result)
+        {
+            parallel_stream_error() = "No result to convert";
+            return nullptr;
+        }
+        if (result->type != QueryResultType::MATERIALIZED_RESULT)
+        {
+            parallel_stream_error() = "Parallel Arrow conversion requires a materialized result";
+            return nullptr;
+        }
+
+        try
+        {
+            // Drain the materialized chunks up front (cheap - the data is
+            // already in memory); the expensive Arrow conversion follows
+            duckdb::vector<duckdb::unique_ptr<DataChunk>> chunks;
+            for (;;)
+            {
+                auto chunk = result->Fetch();
+                if (!chunk || chunk->size() == 0)
+                {
+                    break;
+                }
+                chunks.push_back(std::move(chunk));
+            }
+
+            // Partition into contiguous runs of ~rows_per_batch rows; each
+            // run becomes one output batch, matching the serial path's shape
+            struct ConvertTask
+            {
+                size_t first_chunk;
+                size_t chunk_count;
+                idx_t rows;
+            };
+            std::vector<ConvertTask> tasks;
+            size_t chunk_idx = 0;
+            while (chunk_idx < chunks.size())
+            {
+                ConvertTask task {chunk_idx, 0, 0};
+                while (chunk_idx < chunks.size() &&
+                       (task.chunk_count == 0 || task.rows + chunks[chunk_idx]->size() <= rows_per_batch))
+                {
+                    task.rows += chunks[chunk_idx]->size();
+                    task.chunk_count++;
+                    chunk_idx++;
+                }
+                tasks.push_back(task);
+            }
+
+            auto extension_types = ArrowTypeExtensionData::GetExtensionTypes(
+                *result->client_properties.client_context, result->types);
+
+            auto wrapper = duckdb::make_uniq<ParallelArrowArrayStreamWrapper>();
+            wrapper->arrays.resize(tasks.size());
+
+            std::atomic<size_t> next_task {0};
+            std::atomic<bool> failed {false};
+            std::mutex error_mutex;
+            std::string first_error;
+
+            auto convert_worker = [&]()
+            {
+                for (;;)
+                {
+                    const size_t task_idx = next_task.fetch_add(1);
+                    if (task_idx >= tasks.size() || failed.load())
+                    {
+                        return;
+                    }
+                    try
+                    {
+                        const auto &task = tasks[task_idx];
+                        ArrowAppender appender(
+                            result->types, task.rows,
+                            result->client_properties, extension_types);
+                        for (size_t i = 0; i < task.chunk_count; i++)
+                        {
+                            auto &chunk = *chunks[task.first_chunk + i];
+                            appender.Append(chunk, 0, chunk.size(), chunk.size());
+                        }
+                        wrapper->arrays[task_idx] = appender.Finalize();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!failed.exchange(true))
+                        {
+                            first_error = e.what();
+                        }
+                        return;
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!failed.exchange(true))
+                        {
+                            first_error = "Unknown error in parallel Arrow conversion";
+                        }
+                        return;
+                    }
+                }
+            };
+
+            size_t num_workers = std::thread::hardware_concurrency();
+            if (num_workers == 0)
+            {
+                num_workers = 4;
+            }
+            num_workers = std::min({num_workers, tasks.size(), static_cast<size_t>(8)});
+
+            if (num_workers > 1)
+            {
+                std::vector<std::thread> workers;
+                workers.reserve(num_workers);
+                for (size_t i = 0; i < num_workers; i++)
+                {
+                    workers.emplace_back(convert_worker);
+                }
+                for (auto &worker : workers)
+                {
+                    worker.join();
+                }
+            }
+            else
+            {
+                convert_worker();
+            }
+
+            if (failed.load())
+            {
+                // Wrapper destructor releases whatever was produced
+                parallel_stream_error() = first_error.empty()
+                                              ? "Unknown error in parallel Arrow conversion"
+                                              : first_error;
+                return nullptr;
+            }
+
+            ArrowConverter::ToArrowSchema(
+                &wrapper->schema,
+                result->types,
+                result->names,
+                result->client_properties);
+
+            // The Arrow arrays own their buffers now - free the DuckDB
+            // result early to halve peak memory
+            chunks.clear();
+            owned_result.reset();
+
+            auto *stream = new ArrowArrayStream();
+            stream->private_data = wrapper.release();
+            stream->get_schema = ParallelArrowArrayStreamWrapper::GetSchema;
+            stream->get_next = ParallelArrowArrayStreamWrapper::GetNext;
+            stream->release = ParallelArrowArrayStreamWrapper::Release;
+            stream->get_last_error = ParallelArrowArrayStreamWrapper::GetLastError;
+            return stream;
+        }
+        catch (const std::exception &e)
+        {
+            parallel_stream_error() = e.what();
+            return nullptr;
+        }
+        catch (...)
+        {
+            parallel_stream_error() = "Unknown error in parallel Arrow conversion";
+            return nullptr;
+        }
+    }
+
+    struct ErrorStreamWrapper
+    {
+        std::string error_message;
+        ArrowSchemaWrapper cached_schema;
+        bool schema_cached = false;
+
+        explicit ErrorStreamWrapper(const std::string &msg, const ArrowSchema &schema)
+            : error_message(msg)
+        {
+            cached_schema.arrow_schema = schema;
+            cached_schema.arrow_schema.release = nullptr; // Don't free, we're borrowing
+            schema_cached = true;
+        }
+
+        static int error_get_schema(ArrowArrayStream *stream, ArrowSchema *out)
+        {
+            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
+            if (wrapper->schema_cached)
+            {
+                *out = wrapper->cached_schema.arrow_schema;
+                out->release = nullptr; // Don't let caller free it
+                return 0;
+            }
+            return -1;
+        }
+
+        static int error_get_next(ArrowArrayStream *stream, ArrowArray *out)
+        {
+            out->release = nullptr; // Signal end-of-stream
+            return -1;
+        }
+
+        static const char *error_get_last_error(ArrowArrayStream *stream)
+        {
+            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
+            return wrapper->error_message.c_str();
+        }
+
+        static void error_release(ArrowArrayStream *stream)
+        {
+            auto *wrapper = static_cast<ErrorStreamWrapper *>(stream->private_data);
+            delete wrapper;
+            stream->release = nullptr;
+        }
+    };
+
+    // Single-use stream wrapper - Wraps an ArrowArrayStream to detect and prevent reuse
+    // Experimental idea - add some safety to prevent reuse of capsules / readers that have
+    // been exhausted
+    struct SingleUseStreamWrapper
+    {
+        ArrowArrayStream *underlying_stream;
+        bool consumed = false;
+        bool started = false;
+        std::string error_message;
+        std::mutex mutex;               // EXPERIMENTAL Bugfix: Serialize access to prevent concurrent get_next() calls
+        uint64_t creating_query_number; // Deadlock detection
+
+        static bool use_mutex()
+        {
+            static bool enabled = []()
+            {
+                const char *env = std::getenv("BAREDUCKDB_STREAM_MUTEX");
+                return !(env && std::string(env) == "0");
+            }();
+            return enabled;
+        }
+
+        static int wrapped_get_schema(ArrowArrayStream *stream, ArrowSchema *out)
+        {
+            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
+
+            // TODO: Decide if needed... this was during debugging
+            if (!wrapper->underlying_stream || !wrapper->underlying_stream->get_schema)
+            {
+                wrapper->error_message =
+                    "Arrow stream is invalid. Capsule may have been garbage collected";
+                return -1;
+            }
+
+            return wrapper->underlying_stream->get_schema(wrapper->underlying_stream, out);
+        }
+
+        static int wrapped_get_next(ArrowArrayStream *stream, ArrowArray *out)
+        {
+            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
+
+            // EXPERIMENTAL: Lock to serialize access from DuckDB's parallel threads
+            // This reduces race conditions when arrow_reader() triggers lazy execution
+            std::unique_lock<std::mutex> lock(wrapper->mutex, std::defer_lock);
+            if (use_mutex())
+            {
+                lock.lock();
+            }
+
+            // DEFENSIVE CHECK: Validate stream pointer before dereferencing
+            // This can happen if the PyCapsule was garbage collected while still in use
+            if (!wrapper->underlying_stream || !wrapper->underlying_stream->get_next)
+            {
+                wrapper->error_message =
+                    "Arrow stream is invalid. Capsule may have been garbage collected";
+                return -1;
+            }
+
+            int result = wrapper->underlying_stream->get_next(wrapper->underlying_stream, out);
+
+            return result;
+        }
+
+        static const char *wrapped_get_last_error(ArrowArrayStream *stream)
+        {
+            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
+            std::unique_lock<std::mutex> lock(wrapper->mutex, std::defer_lock);
+            if (use_mutex())
+            {
+                lock.lock();
+            }
+            if (!wrapper->error_message.empty())
+            {
+                return wrapper->error_message.c_str();
+            }
+            return wrapper->underlying_stream->get_last_error(wrapper->underlying_stream);
+        }
+
+        static void wrapped_release(ArrowArrayStream *stream)
+        {
+            auto *wrapper = static_cast<SingleUseStreamWrapper *>(stream->private_data);
+
+            if (wrapper->underlying_stream && wrapper->underlying_stream->release)
+            {
+                auto release_fn = wrapper->underlying_stream->release;
+                auto *underlying = wrapper->underlying_stream;
+
+                wrapper->underlying_stream = nullptr;
+
+                release_fn(underlying);
+            }
+
+            delete wrapper;
+            stream->release = nullptr;
+        }
+    };
+
+    // Store ArrowArrayStream* directly
+    namespace RawStreamCallbacks
+    {
+        // Note: These functions are reserved for future raw stream support
+        // Currently unused but kept for potential stream registration feature
+        [[maybe_unused]] static void GetSchema(uintptr_t factory_ptr, ArrowSchema &schema)
+        {
+            auto *stream = reinterpret_cast<ArrowArrayStream *>(factory_ptr);
+            int result = stream->get_schema(stream, &schema);
+            if (result != 0)
+            {
+                throw std::runtime_error("Failed to get schema from raw arrow stream");
+            }
+        }
+
+        [[maybe_unused]] static duckdb::unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(uintptr_t factory_ptr, ArrowStreamParameters &params)
+        {
+            auto *stream = reinterpret_cast<ArrowArrayStream *>(factory_ptr);
+            auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
+            wrapper->arrow_array_stream = *stream;
+            stream->release = nullptr;
+            return wrapper;
+        }
+    }
+
+    struct CapsuleArrowStreamFactory
+    {
+        duckdb::ArrowArrayStreamWrapper stream;
+        ArrowSchemaWrapper cached_schema;
+        int64_t cardinality;
+        std::atomic<bool> produced{false};
+        uint64_t creating_query_number; // Deadlock Detection
+
+        explicit CapsuleArrowStreamFactory(ArrowArrayStream *source_stream, int64_t cardinality_p = -1, uint64_t query_num = 0)
+            : cardinality(cardinality_p), creating_query_number(query_num)
+        {
+            stream.arrow_array_stream = *source_stream;
+            source_stream->release = nullptr;
+
+            int result = stream.arrow_array_stream.get_schema(&stream.arrow_array_stream, &cached_schema.arrow_schema);
+            if (result != 0)
+            {
+                throw std::runtime_error("Failed to get schema from capsule stream");
+            }
+        }
+
+        static void GetSchema(uintptr_t factory_ptr, ArrowSchema &schema)
+        {
+            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+            schema = factory->cached_schema.arrow_schema;
+            schema.release = nullptr;
+        }
+
+        static duckdb::unique_ptr<duckdb::ArrowArrayStreamWrapper> Produce(uintptr_t factory_ptr, ArrowStreamParameters &params)
+        {
+            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+
+            bool expected = false;
+            if (!factory->produced.compare_exchange_strong(expected, true))
+            {
+                auto error_wrapper_ptr = new ErrorStreamWrapper(
+                    "Arrow stream has already been consumed",
+                    factory->cached_schema.arrow_schema);
+
+                auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
+                wrapper->arrow_array_stream.get_schema = ErrorStreamWrapper::error_get_schema;
+                wrapper->arrow_array_stream.get_next = ErrorStreamWrapper::error_get_next;
+                wrapper->arrow_array_stream.get_last_error = ErrorStreamWrapper::error_get_last_error;
+                wrapper->arrow_array_stream.release = ErrorStreamWrapper::error_release;
+                wrapper->arrow_array_stream.private_data = error_wrapper_ptr;
+
+                return wrapper;
+            }
+
+            auto wrapper = duckdb::make_uniq<duckdb::ArrowArrayStreamWrapper>();
+            wrapper->arrow_array_stream = factory->stream.arrow_array_stream;
+
+            factory->stream.arrow_array_stream.release = nullptr;
+
+            return wrapper;
+        }
 
         static int64_t GetCardinality(uintptr_t factory_ptr)
         {
-            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
-            return factory->cardinality;
+            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+            return factory->cardinality;
+        }
+
+        static uint64_t GetCreatingQueryNumber(uintptr_t factory_ptr)
+        {
+            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+            return factory ? factory->creating_query_number : 0;
+        }
+    };
+
+    struct FactoryDependencyItem : public DependencyItem
+    {
+        void *factory_ptr;
+
+        explicit FactoryDependencyItem(void *ptr) : factory_ptr(ptr) {}
+
+        ~FactoryDependencyItem() override
+        {
+            if (factory_ptr)
+            {
+                delete static_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+            }
+        }
+    };
+
+    extern "C" void register_capsule_stream(
+        duckdb_connection c_conn,
+        void *stream_capsule_ptr,
+        const char *view_name,
+        int64_t cardinality,
+        bool replace)
+    {
+        try
+        {
+            auto conn = get_cpp_connection(c_conn);
+            if (!conn)
+            {
+                throw std::runtime_error("Invalid connection");
+            }
+
+            auto context = conn->context;
+            std::string view_name_str(view_name);
+
+            if (replace)
+            {
+                try
+                {
+                    std::string drop_sql = "DROP VIEW IF EXISTS " + KeywordHelper::WriteQuoted(view_name_str, '"');
+                    context->Query(drop_sql, false);
+                }
+                catch (...)
+                {
+                }
+            }
+
+            auto *stream_capsule = reinterpret_cast<PyObject *>(stream_capsule_ptr);
+
+            if (!PyCapsule_CheckExact(stream_capsule))
+            {
+                throw std::runtime_error("Expected PyCapsule containing ArrowArrayStream");
+            }
+
+            auto *original_stream = static_cast<ArrowArrayStream *>(PyCapsule_GetPointer(stream_capsule, "arrow_array_stream"));
+            if (!original_stream)
+            {
+                throw std::runtime_error("Invalid stream capsule - null pointer");
+            }
+
+            // Verify stream hasn't been released
+            if (!original_stream->release)
+            {
+                throw std::runtime_error(
+                    "Arrow stream has already been released/consumed");
+            }
+
+            // Safety check - get schema to validate stream is accessible
+            if (original_stream->get_schema)
+            {
+                ArrowSchema test_schema;
+                int schema_result = original_stream->get_schema(original_stream, &test_schema);
+                if (schema_result != 0)
+                {
+                    const char *error_msg = original_stream->get_last_error ? original_stream->get_last_error(original_stream) : "Unknown error";
+                    throw std::runtime_error(
+                        std::string("Arrow stream schema validation failed: ") + error_msg + ". "
+                                                                                             "The stream may have been consumed or is in an invalid state. ");
+                }
+                if (test_schema.release)
+                {
+                    test_schema.release(&test_schema);
+                }
+            }
+
+            auto table_function = duckdb::make_uniq<TableFunctionRef>();
+            duckdb::vector<duckdb::unique_ptr<ParsedExpression>> children;
+            const char *scan_function;
+            void *factory_to_release = nullptr;
+
+            // Always wrap in SingleUseStreamWrapper to prevent reuse and segfaults
+            // even for use_raw_stream=True, because RawStreamCallbacks::Produce consumes the stream
+            {
+                auto *wrapper_ptr = new SingleUseStreamWrapper();
+                wrapper_ptr->underlying_stream = original_stream;
+
+                // Deadlock Detection: extract creating_query_number from underlying stream
+                uint64_t extracted_query_number = 0;
+                if (original_stream->private_data)
+                {
+                    if (original_stream->get_next == StreamingArrowArrayStreamWrapper::GetNext)
+                    {
+                        auto *streaming_wrapper = reinterpret_cast<StreamingArrowArrayStreamWrapper *>(original_stream->private_data);
+                        extracted_query_number = streaming_wrapper->creating_query_number;
+                    }
+                }
+                wrapper_ptr->creating_query_number = extracted_query_number;
+
+                auto *wrapped_stream = new ArrowArrayStream();
+                wrapped_stream->get_schema = SingleUseStreamWrapper::wrapped_get_schema;
+                wrapped_stream->get_next = SingleUseStreamWrapper::wrapped_get_next;
+                wrapped_stream->get_last_error = SingleUseStreamWrapper::wrapped_get_last_error;
+                wrapped_stream->release = SingleUseStreamWrapper::wrapped_release;
+                wrapped_stream->private_data = wrapper_ptr;
+
+                auto capsule_factory = duckdb::make_uniq<CapsuleArrowStreamFactory>(wrapped_stream, cardinality, wrapper_ptr->creating_query_number);
+
+                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(capsule_factory.get()))));
+                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::Produce))));
+                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::GetSchema))));
+
+                scan_function = "arrow_scan_dumb";
+
+                factory_to_release = capsule_factory.release();
+            }
+
+            table_function->function = duckdb::make_uniq<FunctionExpression>(scan_function, std::move(children));
+
+            auto external_dependency = duckdb::make_shared_ptr<ExternalDependency>();
+
+            if (factory_to_release)
+            {
+                auto factory_dep = duckdb::make_shared_ptr<FactoryDependencyItem>(factory_to_release);
+                external_dependency->AddDependency("arrow_factory", factory_dep);
+            }
+
+            table_function->external_dependency = std::move(external_dependency);
+
+            auto view_relation = duckdb::make_shared_ptr<ViewRelation>(context, std::move(table_function), view_name_str);
+            view_relation->CreateView(view_name_str, replace, true);
+        }
+        catch (const std::exception &e)
+        {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Unknown error in register_capsule_stream");
+        }
+    }
+
+    // Bulk-append an Arrow stream into an existing table.
+    // Takes ownership of the capsule's stream and runs a native
+    // INSERT INTO ... SELECT * FROM arrow_scan_dumb(...), so the whole batch
+    // is ingested in one query with no per-value Python->C transitions.
+    // The GIL is released while the insert executes.
+    // Stream columns must match the table's column order.
+    extern "C" bool append_capsule_stream_to_table(
+        duckdb_connection c_conn,
+        void *stream_capsule_ptr,
+        const char *schema_name,
+        const char *table_name)
+    {
+        try
+        {
+            auto conn = get_cpp_connection(c_conn);
+            if (!conn)
+            {
+                throw std::runtime_error("Invalid connection");
+            }
+
+            auto *stream_capsule = reinterpret_cast<PyObject *>(stream_capsule_ptr);
+
+            if (!PyCapsule_CheckExact(stream_capsule))
+            {
+                throw std::runtime_error("Expected PyCapsule containing ArrowArrayStream");
+            }
+
+            auto *original_stream = static_cast<ArrowArrayStream *>(PyCapsule_GetPointer(stream_capsule, "arrow_array_stream"));
+            if (!original_stream)
+            {
+                throw std::runtime_error("Invalid stream capsule - null pointer");
+            }
+
+            if (!original_stream->release)
+            {
+                throw std::runtime_error(
+                    "Arrow stream has already been released/consumed");
+            }
+
+            // Factory takes ownership of the stream; the produced flag makes it single use
+            auto factory = duckdb::make_uniq<CapsuleArrowStreamFactory>(original_stream);
+
+            duckdb::vector<Value> params;
+            params.push_back(Value::POINTER(CastPointerToValue(factory.get())));
+            params.push_back(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::Produce)));
+            params.push_back(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::GetSchema)));
+
+            auto relation = conn->TableFunction("arrow_scan_dumb", params);
+
+            std::string schema_str = schema_name ? schema_name : "";
+            std::string table_str(table_name);
+
+            bool success = true;
+            std::string error_message;
+
+            // Stream consumption is fully native - run the insert without the GIL
+            Py_BEGIN_ALLOW_THREADS
+            try
+            {
+                if (schema_str.empty())
+                {
+                    relation->Insert(table_str);
+                }
+                else
+                {
+                    relation->Insert(schema_str, table_str);
+                }
+            }
+            catch (const std::exception &e)
+            {
+                success = false;
+                error_message = e.what();
+            }
+            catch (...)
+            {
+                success = false;
+                error_message = "Unknown error during bulk append";
+            }
+            Py_END_ALLOW_THREADS
+
+            if (!success)
+            {
+                throw std::runtime_error(error_message);
+            }
+
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return false;
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Unknown error in append_capsule_stream_to_table");
+            return false;
+        }
+    }
+
+    // Drains one ArrowArrayStream into an appender: each Arrow chunk is
+    // converted to DataChunks with the same machinery the arrow scan uses
+    // (ArrowToDuckDB) and handed to the appender, so nothing passes through
+    // parse/bind/plan. Returns the number of rows appended.
+    inline int64_t consume_arrow_stream_into_appender(
+        ClientContext &context,
+        Appender &appender,
+        ArrowArrayStream *stream,
+        const duckdb::vector<LogicalType> &types,
+        ArrowTableType &arrow_table)
+    {
+        int64_t rows = 0;
+        while (true)
+        {
+            auto chunk = duckdb::make_shared_ptr<ArrowArrayWrapper>();
+            if (stream->get_next(stream, &chunk->arrow_array) != 0)
+            {
+                const char *err = stream->get_last_error(stream);
+                throw std::runtime_error(err ? err : "Arrow stream get_next failed");
+            }
+            if (!chunk->arrow_array.release)
+            {
+                break; // end of stream
+            }
+            if (chunk->arrow_array.length == 0)
+            {
+                continue;
+            }
+
+            ArrowScanLocalState state(make_uniq<ArrowArrayWrapper>(), context);
+            state.chunk = chunk;
+            auto chunk_len = (idx_t)chunk->arrow_array.length;
+
+            while (state.chunk_offset < chunk_len)
+            {
+                DataChunk output;
+                output.Initialize(Allocator::Get(context), types);
+                idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, chunk_len - state.chunk_offset);
+                output.SetCardinality(count);
+                ArrowTableFunction::ArrowToDuckDB(state, arrow_table.GetColumns(), output, (idx_t)rows, false);
+                output.Verify();
+                state.chunk_offset += output.size();
+                appender.AppendDataChunk(output);
+                rows += (int64_t)output.size();
+            }
+        }
+        return rows;
+    }
+
+    // Bulk-load one or more Arrow streams into a table through DuckDB's
+    // appender, bypassing the planner entirely - the straight-copy
+    // counterpart of CREATE TABLE AS SELECT * FROM view. With several
+    // streams (independent partitions of the same data) each gets its own
+    // appender on a worker thread, so Arrow->DataChunk conversion runs in
+    // parallel; appender flushes serialize on the connection internally.
+    // When create_table is set the target is created first from the first
+    // stream's schema. The GIL is released while the load runs, so streams
+    // must be consumable without Python (pyarrow/polars exports are).
+    // Stream columns must match the table's column order.
+    // Returns total rows loaded; -1 with a Python error set on failure.
+    extern "C" int64_t load_arrow_streams_into_table(
+        duckdb_connection c_conn,
+        void **stream_ptrs,
+        size_t num_streams,
+        const char *schema_name,
+        const char *table_name,
+        bool create_table,
+        bool replace)
+    {
+        try
+        {
+            auto conn = get_cpp_connection(c_conn);
+            if (!conn)
+            {
+                throw std::runtime_error("Invalid connection");
+            }
+            auto context = conn->context;
+
+            if (num_streams == 0 || !stream_ptrs)
+            {
+                throw std::runtime_error("No streams to load");
+            }
+            for (size_t s = 0; s < num_streams; s++)
+            {
+                auto *stream = static_cast<ArrowArrayStream *>(stream_ptrs[s]);
+                if (!stream || !stream->release)
+                {
+                    throw std::runtime_error("Arrow stream has already been released/consumed");
+                }
+            }
+
+            // All partitions share the first stream's schema
+            auto *first = static_cast<ArrowArrayStream *>(stream_ptrs[0]);
+            ArrowSchemaWrapper schema_root;
+            if (first->get_schema(first, &schema_root.arrow_schema) != 0)
+            {
+                const char *err = first->get_last_error(first);
+                throw std::runtime_error(err ? err : "Failed to get schema from Arrow stream");
+            }
+
+            ArrowTableType arrow_table;
+            ArrowTableFunction::PopulateArrowTableSchema(DBConfig::GetConfig(*context), arrow_table,
+                                                         schema_root.arrow_schema);
+            auto names = arrow_table.GetNames();
+            auto types = arrow_table.GetTypes();
+
+            std::string schema_str = schema_name ? schema_name : "";
+            std::string table_str(table_name);
+
+            int64_t total_rows = 0;
+            std::string error_message;
+
+            Py_BEGIN_ALLOW_THREADS
+            try
+            {
+                if (create_table)
+                {
+                    std::string qualified;
+                    if (!schema_str.empty())
+                    {
+                        qualified = KeywordHelper::WriteOptionallyQuoted(schema_str) + ".";
+                    }
+                    qualified += KeywordHelper::WriteOptionallyQuoted(table_str);
+
+                    std::string ddl = replace ? "CREATE OR REPLACE TABLE " : "CREATE TABLE ";
+                    ddl += qualified + " (";
+                    for (size_t i = 0; i < names.size(); i++)
+                    {
+                        if (i > 0)
+                        {
+                            ddl += ", ";
+                        }
+                        ddl += KeywordHelper::WriteOptionallyQuoted(names[i]) + " " + types[i].ToString();
+                    }
+                    ddl += ")";
+
+                    auto ddl_result = context->Query(ddl, false);
+                    if (ddl_result->HasError())
+                    {
+                        throw std::runtime_error(ddl_result->GetError());
+                    }
+                }
+
+                // Appender construction hits the catalog - do it serially
+                std::vector<duckdb::unique_ptr<Appender>> appenders;
+                for (size_t s = 0; s < num_streams; s++)
+                {
+                    if (schema_str.empty())
+                    {
+                        appenders.push_back(make_uniq<Appender>(*conn, table_str));
+                    }
+                    else
+                    {
+                        appenders.push_back(make_uniq<Appender>(*conn, schema_str, table_str));
+                    }
+                }
+
+                if (num_streams == 1)
+                {
+                    total_rows = consume_arrow_stream_into_appender(
+                        *context, *appenders[0], first, types, arrow_table);
+                }
+                else
+                {
+                    std::vector<int64_t> rows_loaded(num_streams, 0);
+                    std::vector<std::string> worker_errors(num_streams);
+                    std::vector<std::thread> workers;
+                    workers.reserve(num_streams);
+
+                    for (size_t s = 0; s < num_streams; s++)
+                    {
+                        workers.emplace_back([&, s]()
+                                             {
+                            try
+                            {
+                                rows_loaded[s] = consume_arrow_stream_into_appender(
+                                    *context, *appenders[s],
+                                    static_cast<ArrowArrayStream *>(stream_ptrs[s]),
+                                    types, arrow_table);
+                            }
+                            catch (const std::exception &e)
+                            {
+                                worker_errors[s] = e.what();
+                            }
+                            catch (...)
+                            {
+                                worker_errors[s] = "Unknown error during bulk load";
+                            } });
+                    }
+                    for (auto &worker : workers)
+                    {
+                        worker.join();
+                    }
+                    for (auto &err : worker_errors)
+                    {
+                        if (!err.empty())
+                        {
+                            throw std::runtime_error(err);
+                        }
+                    }
+                    for (auto rows : rows_loaded)
+                    {
+                        total_rows += rows;
+                    }
+                }
+
+                for (auto &appender : appenders)
+                {
+                    appender->Close();
+                }
+            }
+            catch (const std::exception &e)
+            {
+                error_message = e.what();
+            }
+            catch (...)
+            {
+                error_message = "Unknown error during bulk load";
+            }
+            Py_END_ALLOW_THREADS
+
+            if (!error_message.empty())
+            {
+                throw std::runtime_error(error_message);
+            }
+
+            return total_rows;
+        }
+        catch (const std::exception &e)
+        {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return -1;
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Unknown error in load_arrow_streams_into_table");
+            return -1;
+        }
+    }
+
+    extern "C" void unregister_python_object(
+        duckdb_connection c_conn,
+        const char *view_name)
+    {
+        try
+        {
+            auto conn = get_cpp_connection(c_conn);
+            if (!conn)
+            {
+                throw std::runtime_error("Invalid connection");
+            }
+
+            auto context = conn->context;
+            std::string view_name_str(view_name);
+
+            std::string drop_sql = "DROP VIEW " + KeywordHelper::WriteQuoted(view_name_str, '"');
+            context->Query(drop_sql, false);
+        }
+        catch (const std::exception &e)
+        {
+            PyErr_SetString(PyExc_RuntimeError, e.what());
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Unknown error in unregister_python_object");
+        }
+    }
+
+    // Per-connection LRU cache of prepared statements keyed by query text.
+    // Avoids re-running parse/bind/plan for hot parameterized queries.
+    struct PreparedStatementCache
+    {
+        std::mutex mutex;
+        size_t capacity;
+        std::list<std::string> lru; // front = most recently used
+        std::unordered_map<std::string, std::pair<std::list<std::string>::iterator,
+                                                  duckdb::shared_ptr<duckdb::PreparedStatement>>>
+            entries;
+
+        explicit PreparedStatementCache(size_t capacity_p) : capacity(capacity_p) {}
+
+        duckdb::shared_ptr<duckdb::PreparedStatement> Get(const std::string &query)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(query);
+            if (it == entries.end())
+            {
+                return nullptr;
+            }
+            lru.splice(lru.begin(), lru, it->second.first);
+            return it->second.second;
+        }
+
+        void Put(const std::string &query, duckdb::shared_ptr<duckdb::PreparedStatement> stmt)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(query);
+            if (it != entries.end())
+            {
+                lru.splice(lru.begin(), lru, it->second.first);
+                it->second.second = std::move(stmt);
+                return;
+            }
+            while (entries.size() >= capacity && !lru.empty())
+            {
+                entries.erase(lru.back());
+                lru.pop_back();
+            }
+            lru.push_front(query);
+            entries[query] = {lru.begin(), std::move(stmt)};
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            entries.clear();
+            lru.clear();
+        }
+    };
+
+    extern "C" void *prepared_cache_create(size_t capacity)
+    {
+        try
+        {
+            return new PreparedStatementCache(capacity);
+        }
+        catch (...)
+        {
+            return nullptr;
         }
+    }
 
-        static uint64_t GetCreatingQueryNumber(uintptr_t factory_ptr)
+    extern "C" void prepared_cache_clear(void *cache_ptr)
+    {
+        if (cache_ptr)
         {
-            auto *factory = reinterpret_cast<CapsuleArrowStreamFactory *>(factory_ptr);
-            return factory ? factory->creating_query_number : 0;
+            reinterpret_cast<PreparedStatementCache *>(cache_ptr)->Clear();
         }
-    };
+    }
 
-    struct FactoryDependencyItem : public DependencyItem
+    extern "C" void prepared_cache_destroy(void *cache_ptr)
     {
-        void *factory_ptr;
+        delete reinterpret_cast<PreparedStatementCache *>(cache_ptr);
+    }
 
-        explicit FactoryDependencyItem(void *ptr) : factory_ptr(ptr) {}
+    // Free-list of warm duckdb_connection handles sharing one database.
+    // Checkout pops a warm handle so cursor creation skips duckdb_connect
+    // (catalog init, client context construction); checkin resets session
+    // state and parks the handle for reuse. Lifetime is shared between the
+    // root connection and its cursors via shared_ptr, mirroring
+    // DatabaseHandle - the destructor runs once the last holder closes.
+    struct ConnectionPool
+    {
+        std::mutex mutex;
+        std::vector<duckdb_connection> idle;
+        size_t max_idle;
 
-        ~FactoryDependencyItem() override
+        explicit ConnectionPool(size_t max_idle_p) : max_idle(max_idle_p) {}
+
+        ~ConnectionPool()
         {
-            if (factory_ptr)
+            for (auto conn : idle)
             {
-                delete static_cast<CapsuleArrowStreamFactory *>(factory_ptr);
+                duckdb_disconnect(&conn);
             }
         }
+
+        ConnectionPool(const ConnectionPool &) = delete;
+        ConnectionPool &operator=(const ConnectionPool &) = delete;
     };
 
-    extern "C" void register_capsule_stream(
-        duckdb_connection c_conn,
-        void *stream_capsule_ptr,
-        const char *view_name,
-        int64_t cardinality,
-        bool replace)
+    // Return a pooled connection to a fresh-session state: roll back any
+    // open transaction, reset session settings, and drop temporary objects
+    // (including leaked capsule/holder view registrations)
+    extern "C" bool reset_pooled_connection(duckdb_connection c_conn)
     {
         try
         {
             auto conn = get_cpp_connection(c_conn);
-            if (!conn)
+            auto context = conn->context;
+            if (!context)
             {
-                throw std::runtime_error("Invalid connection");
+                return false;
             }
 
-            auto context = conn->context;
-            std::string view_name_str(view_name);
+            // Ignore "no transaction is active" failures
+            context->Query("ROLLBACK", false);
 
-            if (replace)
+            auto &config = duckdb::ClientConfig::GetConfig(*context);
+            config.set_variables.clear();
+
+            // Collect names first - dropping while fetching would invalidate
+            // the scan
+            std::vector<std::string> drop_statements;
+            auto tables = context->Query(
+                "SELECT table_name FROM duckdb_tables() WHERE temporary", false);
+            if (tables && !tables->HasError())
             {
-                try
+                while (auto chunk = tables->Fetch())
                 {
-                    std::string drop_sql = "DROP VIEW IF EXISTS " + KeywordHelper::WriteQuoted(view_name_str, '"');
-                    context->Query(drop_sql, false);
+                    for (idx_t i = 0; i < chunk->size(); i++)
+                    {
+                        drop_statements.push_back(
+                            "DROP TABLE IF EXISTS temp." +
+                            duckdb::KeywordHelper::WriteOptionallyQuoted(chunk->GetValue(0, i).ToString()));
+                    }
                 }
-                catch (...)
+            }
+            auto views = context->Query(
+                "SELECT view_name FROM duckdb_views() WHERE temporary AND NOT internal", false);
+            if (views && !views->HasError())
+            {
+                while (auto chunk = views->Fetch())
                 {
+                    for (idx_t i = 0; i < chunk->size(); i++)
+                    {
+                        drop_statements.push_back(
+                            "DROP VIEW IF EXISTS temp." +
+                            duckdb::KeywordHelper::WriteOptionallyQuoted(chunk->GetValue(0, i).ToString()));
+                    }
                 }
             }
-
-            auto *stream_capsule = reinterpret_cast<PyObject *>(stream_capsule_ptr);
-
-            if (!PyCapsule_CheckExact(stream_capsule))
+            for (const auto &stmt : drop_statements)
             {
-                throw std::runtime_error("Expected PyCapsule containing ArrowArrayStream");
+                auto result = context->Query(stmt, false);
+                if (result && result->HasError())
+                {
+                    return false;
+                }
             }
 
-            auto *original_stream = static_cast<ArrowArrayStream *>(PyCapsule_GetPointer(stream_capsule, "arrow_array_stream"));
-            if (!original_stream)
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    extern "C" duckdb_connection connection_pool_checkout(void *pool_ptr)
+    {
+        if (!pool_ptr)
+        {
+            return nullptr;
+        }
+        auto *pool = reinterpret_cast<ConnectionPool *>(pool_ptr);
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (pool->idle.empty())
+        {
+            return nullptr;
+        }
+        duckdb_connection conn = pool->idle.back();
+        pool->idle.pop_back();
+        return conn;
+    }
+
+    // Returns false when the pool is full or the session could not be
+    // reset - the caller must disconnect the handle itself in that case
+    extern "C" bool connection_pool_checkin(void *pool_ptr, duckdb_connection conn)
+    {
+        if (!pool_ptr || !conn)
+        {
+            return false;
+        }
+        auto *pool = reinterpret_cast<ConnectionPool *>(pool_ptr);
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (pool->idle.size() >= pool->max_idle)
             {
-                throw std::runtime_error("Invalid stream capsule - null pointer");
+                return false;
             }
+        }
+        if (!reset_pooled_connection(conn))
+        {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (pool->idle.size() >= pool->max_idle)
+        {
+            return false;
+        }
+        pool->idle.push_back(conn);
+        return true;
+    }
 
-            // Verify stream hasn't been released
-            if (!original_stream->release)
+    extern "C" size_t connection_pool_idle_count(void *pool_ptr)
+    {
+        if (!pool_ptr)
+        {
+            return 0;
+        }
+        auto *pool = reinterpret_cast<ConnectionPool *>(pool_ptr);
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        return pool->idle.size();
+    }
+
+    // Execute prepared statement with parameters
+    // cache_ptr: optional PreparedStatementCache* - when set, re-uses the
+    // prepared handle across invocations of the same query text
+    // Background flusher behind the pipelined appender mode. The Python
+    // thread keeps filling one appender's chunk while this worker flushes the
+    // previously filled one, so row production overlaps storage writes.
+    // Appenders rotate: submit hands a filled appender to the worker, acquire
+    // blocks until a flushed one is free again (that wait is the
+    // backpressure). DuckDB's ClientContext serializes the actual Append
+    // internally, so the worker and the caller never race on the connection.
+    struct AppenderFlusher
+    {
+        std::mutex mutex;
+        std::condition_variable cv_work;  // wakes the worker
+        std::condition_variable cv_state; // wakes acquire/drain waiters
+        std::deque<duckdb_appender> pending;
+        std::vector<duckdb_appender> ready;
+        std::string error;
+        bool failed = false;
+        bool stop = false;
+        bool in_flight = false;
+        std::thread worker;
+
+        AppenderFlusher()
+        {
+            worker = std::thread([this]() { Run(); });
+        }
+
+        ~AppenderFlusher()
+        {
             {
-                throw std::runtime_error(
-                    "Arrow stream has already been released/consumed");
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
             }
-
-            // Safety check - get schema to validate stream is accessible
-            if (original_stream->get_schema)
+            cv_work.notify_all();
+            if (worker.joinable())
             {
-                ArrowSchema test_schema;
-                int schema_result = original_stream->get_schema(original_stream, &test_schema);
-                if (schema_result != 0)
-                {
-                    const char *error_msg = original_stream->get_last_error ? original_stream->get_last_error(original_stream) : "Unknown error";
-                    throw std::runtime_error(
-                        std::string("Arrow stream schema validation failed: ") + error_msg + ". "
-                                                                                             "The stream may have been consumed or is in an invalid state. ");
-                }
-                if (test_schema.release)
-                {
-                    test_schema.release(&test_schema);
-                }
+                worker.join();
             }
+        }
 
-            auto table_function = duckdb::make_uniq<TableFunctionRef>();
-            duckdb::vector<duckdb::unique_ptr<ParsedExpression>> children;
-            const char *scan_function;
-            void *factory_to_release = nullptr;
-
-            // Always wrap in SingleUseStreamWrapper to prevent reuse and segfaults
-            // even for use_raw_stream=True, because RawStreamCallbacks::Produce consumes the stream
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;)
             {
-                auto *wrapper_ptr = new SingleUseStreamWrapper();
-                wrapper_ptr->underlying_stream = original_stream;
-
-                // Deadlock Detection: extract creating_query_number from underlying stream
-                uint64_t extracted_query_number = 0;
-                if (original_stream->private_data)
+                cv_work.wait(lock, [this]() { return stop || !pending.empty(); });
+                if (pending.empty())
                 {
-                    if (original_stream->get_next == StreamingArrowArrayStreamWrapper::GetNext)
+                    if (stop)
                     {
-                        auto *streaming_wrapper = reinterpret_cast<StreamingArrowArrayStreamWrapper *>(original_stream->private_data);
-                        extracted_query_number = streaming_wrapper->creating_query_number;
+                        return;
                     }
+                    continue;
                 }
-                wrapper_ptr->creating_query_number = extracted_query_number;
-
-                auto *wrapped_stream = new ArrowArrayStream();
-                wrapped_stream->get_schema = SingleUseStreamWrapper::wrapped_get_schema;
-                wrapped_stream->get_next = SingleUseStreamWrapper::wrapped_get_next;
-                wrapped_stream->get_last_error = SingleUseStreamWrapper::wrapped_get_last_error;
-                wrapped_stream->release = SingleUseStreamWrapper::wrapped_release;
-                wrapped_stream->private_data = wrapper_ptr;
-
-                auto capsule_factory = duckdb::make_uniq<CapsuleArrowStreamFactory>(wrapped_stream, cardinality, wrapper_ptr->creating_query_number);
-
-                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(capsule_factory.get()))));
-                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::Produce))));
-                children.push_back(duckdb::make_uniq<ConstantExpression>(Value::POINTER(CastPointerToValue(&CapsuleArrowStreamFactory::GetSchema))));
-
-                scan_function = "arrow_scan_dumb";
-
-                factory_to_release = capsule_factory.release();
-            }
-
-            table_function->function = duckdb::make_uniq<FunctionExpression>(scan_function, std::move(children));
+                duckdb_appender appender = pending.front();
+                pending.pop_front();
+                in_flight = true;
+                lock.unlock();
 
-            auto external_dependency = duckdb::make_shared_ptr<ExternalDependency>();
+                duckdb_state state = duckdb_appender_flush(appender);
 
-            if (factory_to_release)
-            {
-                auto factory_dep = duckdb::make_shared_ptr<FactoryDependencyItem>(factory_to_release);
-                external_dependency->AddDependency("arrow_factory", factory_dep);
+                lock.lock();
+                if (state != DuckDBSuccess && !failed)
+                {
+                    failed = true;
+                    const char *err = duckdb_appender_error(appender);
+                    error = err ? err : "Unknown appender flush error";
+                }
+                in_flight = false;
+                ready.push_back(appender);
+                cv_state.notify_all();
             }
-
-            table_function->external_dependency = std::move(external_dependency);
-
-            auto view_relation = duckdb::make_shared_ptr<ViewRelation>(context, std::move(table_function), view_name_str);
-            view_relation->CreateView(view_name_str, replace, true);
         }
-        catch (const std::exception &e)
+    };
+
+    extern "C" void *appender_flusher_create()
+    {
+        try
         {
-            PyErr_SetString(PyExc_RuntimeError, e.what());
+            return new AppenderFlusher();
         }
         catch (...)
         {
-            PyErr_SetString(PyExc_RuntimeError, "Unknown error in register_capsule_stream");
+            return nullptr;
         }
     }
 
-    extern "C" void unregister_python_object(
-        duckdb_connection c_conn,
-        const char *view_name)
+    // Hand an idle appender to the rotation (startup)
+    extern "C" void appender_flusher_donate(void *ptr, duckdb_appender appender)
     {
-        try
-        {
-            auto conn = get_cpp_connection(c_conn);
-            if (!conn)
-            {
-                throw std::runtime_error("Invalid connection");
-            }
-
-            auto context = conn->context;
-            std::string view_name_str(view_name);
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
+        std::lock_guard<std::mutex> lock(flusher->mutex);
+        flusher->ready.push_back(appender);
+        flusher->cv_state.notify_all();
+    }
 
-            std::string drop_sql = "DROP VIEW " + KeywordHelper::WriteQuoted(view_name_str, '"');
-            context->Query(drop_sql, false);
-        }
-        catch (const std::exception &e)
+    // Queue a filled appender for background flush
+    extern "C" void appender_flusher_submit(void *ptr, duckdb_appender appender)
+    {
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
         {
-            PyErr_SetString(PyExc_RuntimeError, e.what());
+            std::lock_guard<std::mutex> lock(flusher->mutex);
+            flusher->pending.push_back(appender);
         }
-        catch (...)
+        flusher->cv_work.notify_one();
+    }
+
+    // Block until a flushed appender is free and return it (backpressure)
+    extern "C" duckdb_appender appender_flusher_acquire(void *ptr)
+    {
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
+        std::unique_lock<std::mutex> lock(flusher->mutex);
+        flusher->cv_state.wait(lock, [flusher]() { return !flusher->ready.empty(); });
+        duckdb_appender appender = flusher->ready.back();
+        flusher->ready.pop_back();
+        return appender;
+    }
+
+    // Wait for every queued flush to finish; false if any flush failed
+    extern "C" bool appender_flusher_drain(void *ptr)
+    {
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
+        std::unique_lock<std::mutex> lock(flusher->mutex);
+        flusher->cv_state.wait(lock, [flusher]() { return flusher->pending.empty() && !flusher->in_flight; });
+        return !flusher->failed;
+    }
+
+    // Non-blocking: pop an idle appender for teardown, or NULL when empty
+    extern "C" duckdb_appender appender_flusher_take_ready(void *ptr)
+    {
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
+        std::lock_guard<std::mutex> lock(flusher->mutex);
+        if (flusher->ready.empty())
         {
-            PyErr_SetString(PyExc_RuntimeError, "Unknown error in unregister_python_object");
+            return nullptr;
         }
+        duckdb_appender appender = flusher->ready.back();
+        flusher->ready.pop_back();
+        return appender;
+    }
+
+    extern "C" const char *appender_flusher_error(void *ptr)
+    {
+        auto *flusher = reinterpret_cast<AppenderFlusher *>(ptr);
+        std::lock_guard<std::mutex> lock(flusher->mutex);
+        return flusher->error.empty() ? nullptr : flusher->error.c_str();
+    }
+
+    extern "C" void appender_flusher_destroy(void *ptr)
+    {
+        delete reinterpret_cast<AppenderFlusher *>(ptr);
     }
 
-    // Execute prepared statement with parameters
     extern "C" duckdb::QueryResult *execute_prepared_statement(
         duckdb_connection c_conn,
         const char *query,
         void *params_map_ptr, // std::map<string, BoundParameterData>*
         bool allow_stream_result,
         bool use_arrow_collector,
-        uint64_t batch_size)
+        uint64_t batch_size,
+        void *cache_ptr)
     {
         try
         {
@@ -1185,7 +3450,24 @@ namespace bareduckdb
                     duckdb::ErrorData("Invalid client context"));
             }
 
-            duckdb::unique_ptr<duckdb::PreparedStatement> stmt = conn->Prepare(query);
+            auto *cache = reinterpret_cast<PreparedStatementCache *>(cache_ptr);
+
+            duckdb::shared_ptr<duckdb::PreparedStatement> stmt;
+            if (cache)
+            {
+                stmt = cache->Get(query);
+            }
+            if (!stmt)
+            {
+                int64_t t_prepare = query_timing_start();
+                stmt = duckdb::shared_ptr<duckdb::PreparedStatement>(conn->Prepare(query).release());
+                query_timing_stop(t_prepare, query_timing_state().prepare_ns);
+                if (stmt && stmt->success && cache)
+                {
+                    cache->Put(query, stmt);
+                }
+            }
+
             if (!stmt || !stmt->success)
             {
                 if (stmt && !stmt->success)
@@ -1224,7 +3506,10 @@ namespace bareduckdb
 
             try
             {
+                query_generation_bump();
+                int64_t t0 = query_timing_start();
                 duckdb::unique_ptr<duckdb::QueryResult> result = stmt->Execute(duckdb_param_map, allow_stream_result);
+                query_timing_stop(t0, query_timing_state().execute_ns);
 
                 config.get_result_collector = original;
 
@@ -1508,9 +3793,64 @@ namespace bareduckdb
         }
     }
 
+    // Bounded LRU cache of parse results keyed by query text.
+    // Parsing is connection-independent, so one process-wide cache is shared.
+    // Parse results (including errors) are deterministic per query text.
+    struct ParseResultCache
+    {
+        std::mutex mutex;
+        size_t capacity;
+        std::list<std::string> lru; // front = most recently used
+        std::unordered_map<std::string, std::pair<std::list<std::string>::iterator, ParseResultInfo>> entries;
+
+        explicit ParseResultCache(size_t capacity_p) : capacity(capacity_p) {}
+
+        bool Get(const std::string &query, ParseResultInfo &out)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(query);
+            if (it == entries.end())
+            {
+                return false;
+            }
+            lru.splice(lru.begin(), lru, it->second.first);
+            out = it->second.second;
+            return true;
+        }
+
+        void Put(const std::string &query, const ParseResultInfo &info)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = entries.find(query);
+            if (it != entries.end())
+            {
+                lru.splice(lru.begin(), lru, it->second.first);
+                it->second.second = info;
+                return;
+            }
+
+            if (entries.size() >= capacity && !lru.empty())
+            {
+                entries.erase(lru.back());
+                lru.pop_back();
+            }
+
+            lru.push_front(query);
+            entries.emplace(query, std::make_pair(lru.begin(), info));
+        }
+    };
+
     inline ParseResultInfo parse_sql_extract_refs(const char *sql_query)
     {
+        static ParseResultCache cache(256);
+
         ParseResultInfo result;
+        std::string query(sql_query);
+
+        if (cache.Get(query, result))
+        {
+            return result;
+        }
 
         try
         {
@@ -1521,6 +3861,7 @@ namespace bareduckdb
             {
                 result.error = true;
                 result.error_message = "No statements found";
+                cache.Put(query, result);
                 return result;
             }
 
@@ -1537,6 +3878,7 @@ namespace bareduckdb
             result.error_message = "Unknown parsing error";
         }
 
+        cache.Put(query, result);
         return result;
     }
 
@@ -1,6 +1,7 @@
 # cython: language_level=3
 
-from bareduckdb.core.impl.connection cimport Value, BoundParameterData, case_insensitive_map_t
+from bareduckdb.core.impl.connection cimport Value, BoundParameterData, case_insensitive_map_t, duckdb_vector
 
 cdef Value python_to_value(object obj)
+cdef bint convert_parameter_column(list column, duckdb_vector[Value]& out)
 cdef case_insensitive_map_t transform_parameters(object params)
@@ -189,6 +189,90 @@ cdef Value python_to_value(object obj):
     raise TypeError(f"Not Implemented: parameter type {type(obj).__name__}")
 
 
+cdef bint convert_parameter_column(list column, duckdb_vector[Value]& out):
+    """
+    Batched conversion of one parameter column for execute_many.
+
+    Detects the column's Python type from the first non-None entry, then
+    runs a tight loop with an exact-type-specialized converter writing into
+    the pre-sized vector - skipping the per-value dispatch chain in
+    python_to_value. Returns False when the column is mixed-type or uses a
+    type without a fast path; the caller falls back to per-value conversion.
+    """
+    cdef Py_ssize_t n = len(column)
+    cdef Py_ssize_t i
+    cdef object v
+    cdef object sample = None
+    cdef bytes utf8_bytes
+    cdef string cpp_string
+
+    out.clear()
+    out.reserve(n)
+
+    for i in range(n):
+        if column[i] is not None:
+            sample = column[i]
+            break
+
+    # All-NULL column
+    if sample is None:
+        for i in range(n):
+            out.push_back(Value())
+        return True
+
+    col_type = type(sample)
+
+    try:
+        if col_type is int:
+            for i in range(n):
+                v = column[i]
+                if v is None:
+                    out.push_back(Value())
+                elif type(v) is int:
+                    out.push_back(Value(<int64_t>v))
+                else:
+                    return False
+        elif col_type is float:
+            for i in range(n):
+                v = column[i]
+                if v is None:
+                    out.push_back(Value())
+                elif type(v) is float:
+                    out.push_back(Value(<double>v))
+                else:
+                    return False
+        elif col_type is str:
+            for i in range(n):
+                v = column[i]
+                if v is None:
+                    out.push_back(Value())
+                elif type(v) is str:
+                    utf8_bytes = (<str>v).encode("utf-8")
+                    cpp_string = utf8_bytes
+                    out.push_back(Value(cpp_string))
+                else:
+                    return False
+        elif col_type is date:
+            # Exact date only - datetime is dispatched through the fallback
+            for i in range(n):
+                v = column[i]
+                if v is None:
+                    out.push_back(Value())
+                elif type(v) is date:
+                    utf8_bytes = v.isoformat().encode("utf-8")
+                    cpp_string = utf8_bytes
+                    out.push_back(Value(cpp_string))
+                else:
+                    return False
+        else:
+            return False
+    except OverflowError:
+        # int too large for BIGINT - let python_to_value handle HUGEINT
+        return False
+
+    return True
+
+
 cdef case_insensitive_map_t transform_parameters(object params):
     """
     Transform Python parameters to DuckDB parameter map.
@@ -17,10 +17,25 @@ cdef class _ResultBase:
     cdef bool _consumed
     cdef bool _physical_arrow_collector
     cdef uint64_t _batch_size
+    cdef uint64_t _batch_bytes
     cdef str _collector_mode_internal
+    cdef void* _mem_accounting  # retained reference to the connection's accounting
 
     @staticmethod
     cdef _ResultBase create(
         ConnectionImpl connection, str query, uint64_t batch_size,
-        str mode, object parameters=*
+        str mode, object parameters=*, uint64_t batch_bytes=*
+    )
+
+
+cdef class PendingQueryImpl:
+    cdef void* _pending
+    cdef uint64_t _batch_size
+    cdef str _collector_mode_internal
+    cdef bool _finished
+    cdef ConnectionImpl _connection  # Keep reference to prevent gc
+
+    @staticmethod
+    cdef PendingQueryImpl create(
+        ConnectionImpl connection, str query, uint64_t batch_size, str mode
     )
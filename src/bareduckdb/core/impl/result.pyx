@@ -12,8 +12,10 @@ Cython implementation of DuckDB query results
 
 # Note: importing bool from libcpp caused Cython to add #include <vector>
 # which caused ambiguity w/ std::vector and duckdb::vector
-from libc.stdint cimport uint64_t, uintptr_t
+from libc.stdint cimport int64_t, uint8_t, uint64_t, uintptr_t
+from libc.stdlib cimport malloc, free
 from cpython.pycapsule cimport PyCapsule_New, PyCapsule_GetPointer
+from cpython.bytearray cimport PyByteArray_AsString
 import logging
 
 _logger = logging.getLogger("bareduckdb.result")
@@ -62,19 +64,89 @@ from bareduckdb.core.impl.connection cimport (
     arrow_result_num_arrays,
     arrow_result_consume_arrays,
     consumed_arrays_size,
-    consumed_arrays_export,
+    consumed_arrays_export_all,
+    release_exported_arrays,
     consumed_arrays_free,
     init_streaming_arrow_state,
     fetch_arrow_chunk,
     free_streaming_arrow_state,
     create_arrow_array_stream_from_arrow_result,
     create_streaming_arrow_array_stream,
+    create_streaming_arrow_array_stream_adaptive,
+    create_prefetching_arrow_array_stream,
+    create_parallel_arrow_array_stream,
+    parallel_stream_last_error,
+    pending_query_create,
+    pending_query_poll,
+    pending_query_error,
+    pending_query_get_result,
+    pending_query_destroy,
     export_arrow_result_schema,
     export_streaming_arrow_schema,
+    numpy_export_num_columns,
+    numpy_export_column_name,
+    numpy_export_column_kind,
+    numpy_export_total_rows,
+    numpy_export_copy_column,
+    release_arrow_schema,
     case_insensitive_map_t,
+    QueryPhaseTimings,
+    query_timing_set_enabled,
+    query_timing_reset,
+    query_timing_get,
+    streaming_stream_set_accounting,
+    memory_accounting_retain,
+    memory_accounting_destroy,
+    memory_accounting_last_error,
 )
 
 
+def set_query_timing_enabled(bint enabled):
+    """
+    Toggle per-phase query timing. Disabled paths pay a single flag check;
+    when enabled, prepare/execute/collect/export phases accumulate
+    nanosecond counters per thread (see get_query_timings).
+    """
+    query_timing_set_enabled(enabled)
+
+
+def reset_query_timings():
+    """Zero the calling thread's phase counters."""
+    query_timing_reset()
+
+
+def get_query_timings():
+    """
+    Snapshot the calling thread's phase counters as a dict.
+
+    Durations are monotonic nanoseconds; counters accumulate across queries
+    on this thread until reset_query_timings() is called.
+    """
+    cdef QueryPhaseTimings t
+    query_timing_get(&t)
+    return {
+        "prepare_ns": t.prepare_ns,
+        "execute_ns": t.execute_ns,
+        "collect_ns": t.collect_ns,
+        "schema_export_ns": t.schema_export_ns,
+        "array_export_ns": t.array_export_ns,
+        "batches_exported": t.batches_exported,
+        "rows_exported": t.rows_exported,
+    }
+
+
+# NumPy dtype strings keyed by the NumpyExportKind codes in cpp_helpers.hpp
+_NUMPY_EXPORT_DTYPES = {
+    1: "int8", 2: "int16", 3: "int32", 4: "int64",
+    5: "uint8", 6: "uint16", 7: "uint32", 8: "uint64",
+    9: "float32", 10: "float64",
+    11: "datetime64[D]",
+    12: "datetime64[s]", 13: "datetime64[ms]",
+    14: "datetime64[us]", 15: "datetime64[ns]",
+    16: "timedelta64[us]",
+}
+
+
 cdef class _ResultBase:
 
     def __cinit__(self):
@@ -82,6 +154,7 @@ cdef class _ResultBase:
         self._consumed = False
         self._physical_arrow_collector = False
         self._collector_mode_internal = "arrow"
+        self._mem_accounting = NULL
 
     @property
     def _collector_mode(self):
@@ -90,7 +163,7 @@ cdef class _ResultBase:
     @staticmethod
     cdef _ResultBase create(
         ConnectionImpl connection, str query, uint64_t batch_size,
-        str mode, object parameters=None
+        str mode, object parameters=None, uint64_t batch_bytes=0
     ):
         """
         Create result by executing query.
@@ -101,6 +174,9 @@ cdef class _ResultBase:
             batch_size: Arrow record batch size
             mode: Execution mode ("arrow", "arrow_capsule", "stream")
             parameters: Query parameters (list or dict)
+            batch_bytes: If nonzero, streaming batches are resized after the
+                first chunk to target this many bytes per batch instead of
+                a fixed row count
 
         Returns:
             _ResultBase instance
@@ -110,15 +186,22 @@ cdef class _ResultBase:
         """
         cdef _ResultBase result = _ResultBase()
         result._batch_size = batch_size
+        result._batch_bytes = batch_bytes
         result._collector_mode_internal = mode
+        # Retained: the result may be consumed after the connection closes
+        result._mem_accounting = memory_accounting_retain(connection._mem_accounting)
 
         # Decode mode to execution flags
         cdef bool physical_arrow_collector
         cdef bool stream
 
-        if mode == "stream":
+        if mode in ("stream", "stream_prefetch"):
             physical_arrow_collector = False
             stream = True
+        elif mode == "stream_parallel":
+            # Materialize fully, then convert chunks to Arrow on a worker pool
+            physical_arrow_collector = False
+            stream = False
         else:  # "arrow" or "arrow_capsule"
             physical_arrow_collector = True
             stream = False  # Ignored by PhysicalArrowCollector
@@ -145,7 +228,8 @@ cdef class _ResultBase:
                     <void*>&param_map,
                     stream,
                     physical_arrow_collector,
-                    batch_size
+                    batch_size,
+                    connection._stmt_cache
                 )
 
         elif physical_arrow_collector:
@@ -215,7 +299,7 @@ cdef class _ResultBase:
                 "ARROW_CAPSULE mode should use __arrow_c_stream__(), "
                 "not to_arrow()"
             )
-        elif mode == "stream":
+        elif mode in ("stream", "stream_prefetch", "stream_parallel"):
             return self._to_arrow_stream()
         else:
             raise ValueError(f"Unknown collector mode: {mode}")
@@ -264,21 +348,23 @@ cdef class _ResultBase:
         _logger.debug("Found %i batches", num_arrays)
 
         # Import each Arrow array as a RecordBatch
-        # This follows the duckdb-python pattern:
+        # This follows the duckdb-python pattern, except the schema is
+        # converted exactly once and all arrays are exported in a single
+        # C call instead of N round trips (matters for wide tables):
         # 1. Consume arrays from ArrowQueryResult (transfers ownership)
-        # 2. For each array: export ArrowArray and ArrowSchema
-        # 3. Import using PyArrow's RecordBatch._import_from_c(array_addr, schema_addr)
+        # 2. Export all ArrowArrays into one buffer
+        # 3. Import using PyArrow's RecordBatch._import_from_c(array_addr, schema)
+        #    passing the Schema object imported above - no per-batch schema rebuild
         # 4. Combine batches into a Table
 
         batches = []
-        cdef ArrowArray c_array
         cdef size_t i
         cdef uintptr_t array_addr
-        # schema_addr already declared at top
-        # c_schema already declared at top
+        cdef ArrowArray* c_arrays
+        cdef size_t num_exported
 
         # Get the PyArrow import function
-        # pyarrow.lib.RecordBatch._import_from_c(array_address, schema_address)
+        # pyarrow.lib.RecordBatch._import_from_c(array_address, schema)
         t0 = time.time()
         pyarrow_lib = pa.lib
         batch_import_func = pyarrow_lib.RecordBatch._import_from_c
@@ -286,38 +372,50 @@ cdef class _ResultBase:
         # Consume arrays from ArrowQueryResult
         # This transfers ownership from the result to us, matching duckdb-python behavior
         t0 = time.time()
-        cdef void* consumed_arrays = arrow_result_consume_arrays(arrow_result)
+        cdef void* consumed_arrays = arrow_result_consume_arrays(arrow_result, self._mem_accounting)
+        cdef const char* limit_err
         if consumed_arrays == NULL:
+            limit_err = memory_accounting_last_error()
+            if limit_err != NULL:
+                raise RuntimeError(limit_err.decode("utf-8"))
             raise RuntimeError("Failed to consume arrays from ArrowQueryResult")
 
+        num_arrays = consumed_arrays_size(consumed_arrays)
+        c_arrays = <ArrowArray*>malloc(num_arrays * sizeof(ArrowArray))
+        if c_arrays == NULL:
+            consumed_arrays_free(consumed_arrays)
+            raise MemoryError("Failed to allocate ArrowArray export buffer")
+
+        num_exported = 0
         try:
-            num_arrays = consumed_arrays_size(consumed_arrays)
-
-            for i in range(num_arrays):
-                # Export both ArrowArray and ArrowSchema for this batch
-                # This transfers ownership of the array data to PyArrow
-                if not consumed_arrays_export(
-                    consumed_arrays, arrow_result, i, &c_array, &c_schema
-                ):
-                    raise RuntimeError(
-                        f"Failed to export array/schema at index {i}"
-                    )
+            # Export all arrays in one C call (transfers ownership to us)
+            with nogil:
+                num_exported = consumed_arrays_export_all(
+                    consumed_arrays, c_arrays, num_arrays
+                )
 
-                # Get integer addresses of the structs
-                array_addr = <uintptr_t>&c_array
-                schema_addr = <uintptr_t>&c_schema
+            if num_exported != num_arrays:
+                raise RuntimeError("Failed to export arrays from result")
+
+            for i in range(num_exported):
+                array_addr = <uintptr_t>&c_arrays[i]
 
                 try:
                     # Import as RecordBatch using PyArrow's C Data Interface
-                    # This consumes the ArrowArray and ArrowSchema (calls their release callbacks)
-                    batch = batch_import_func(array_addr, schema_addr)
+                    # This consumes the ArrowArray (calls its release callback)
+                    # and reuses the already-imported Schema object
+                    batch = batch_import_func(array_addr, schema)
 
                     batches.append(batch)
                 except Exception as e:
                     raise RuntimeError(f"Failed to import Arrow array {i}: {e}")
 
         finally:
-            # Always free the consumed arrays vector
+            # Release any exported arrays PyArrow did not take ownership of
+            # (import sets release to NULL on success), then free the export
+            # buffer and the consumed arrays vector
+            release_exported_arrays(c_arrays, num_exported)
+            free(c_arrays)
             consumed_arrays_free(consumed_arrays)
 
         # TODO: Decide if this helps
@@ -334,6 +432,152 @@ cdef class _ResultBase:
 
         return table
 
+    def to_numpy_columns(self):
+        """
+        Export a materialized result directly into NumPy column arrays.
+
+        Copies DuckDB's collected Arrow buffers straight into contiguous
+        per-column buffers in a single C pass - no intermediate pyarrow
+        batches on the way. Only fixed-width columns participate (ints,
+        floats, dates, times, timezone-naive timestamps); any other column
+        type raises and the caller should use to_arrow() instead.
+
+        Columns containing NULLs come back as numpy masked arrays; columns
+        without NULLs are plain ndarrays.
+
+        Returns:
+            dict mapping column name -> numpy.ndarray
+
+        Note:
+            This consumes the result. Requires the materialized "arrow" mode.
+        """
+        import numpy as np
+
+        if self._consumed:
+            raise RuntimeError("Result already consumed")
+
+        if self._result == NULL:
+            raise RuntimeError("No result available")
+
+        if self._collector_mode_internal != "arrow":
+            raise RuntimeError(
+                "to_numpy_columns() requires the materialized 'arrow' mode"
+            )
+
+        self._consumed = True
+
+        cdef ArrowQueryResult* arrow_result
+        with nogil:
+            arrow_result = cast_to_arrow_result(self._result)
+        if arrow_result == NULL:
+            raise RuntimeError("Result is not an ArrowQueryResult")
+
+        cdef ArrowSchema c_schema
+        cdef bool schema_export_success
+        with nogil:
+            schema_export_success = export_arrow_result_schema(
+                arrow_result, &c_schema
+            )
+        if not schema_export_success:
+            raise RuntimeError("Failed to export schema from ArrowQueryResult")
+
+        # Validate every column up front so unsupported types fail before
+        # any data is copied
+        cdef int64_t num_columns = numpy_export_num_columns(&c_schema)
+        cdef int64_t width = 0
+        cdef int kind
+        cdef size_t col
+        cdef const char* c_name
+        names = []
+        kinds = []
+        widths = []
+        try:
+            for col in range(<size_t>num_columns):
+                kind = numpy_export_column_kind(&c_schema, col, &width)
+                c_name = numpy_export_column_name(&c_schema, col)
+                name = c_name.decode("utf-8") if c_name != NULL else str(col)
+                if kind == 0:
+                    raise RuntimeError(
+                        f"to_numpy_columns() does not support column '{name}': "
+                        "only fixed-width numeric/temporal columns - use to_arrow()"
+                    )
+                names.append(name)
+                kinds.append(kind)
+                widths.append(width)
+        finally:
+            release_arrow_schema(&c_schema)
+
+        # Consume + export all batches in one C call, as in _to_arrow_materialized
+        cdef void* consumed_arrays = arrow_result_consume_arrays(arrow_result, self._mem_accounting)
+        cdef const char* limit_err
+        if consumed_arrays == NULL:
+            limit_err = memory_accounting_last_error()
+            if limit_err != NULL:
+                raise RuntimeError(limit_err.decode("utf-8"))
+            raise RuntimeError("Failed to consume arrays from ArrowQueryResult")
+
+        cdef size_t num_arrays = consumed_arrays_size(consumed_arrays)
+        cdef ArrowArray* c_arrays = NULL
+        cdef size_t num_exported = 0
+        cdef int64_t total_rows = 0
+        cdef int64_t null_count
+        cdef char* dest_ptr
+        cdef char* valid_ptr
+
+        columns = {}
+        try:
+            if num_arrays > 0:
+                c_arrays = <ArrowArray*>malloc(num_arrays * sizeof(ArrowArray))
+                if c_arrays == NULL:
+                    raise MemoryError("Failed to allocate ArrowArray export buffer")
+                with nogil:
+                    num_exported = consumed_arrays_export_all(
+                        consumed_arrays, c_arrays, num_arrays
+                    )
+                if num_exported != num_arrays:
+                    raise RuntimeError("Failed to export arrays from result")
+                total_rows = numpy_export_total_rows(c_arrays, num_exported)
+
+            for col in range(<size_t>num_columns):
+                dtype = np.dtype(_NUMPY_EXPORT_DTYPES[kinds[col]])
+                width = widths[col]
+                # bytearray keeps ownership on the Python side; the final
+                # ndarray is a zero-copy view over it
+                data_buf = bytearray(total_rows * width)
+                validity_buf = bytearray(total_rows)
+                null_count = 0
+                if total_rows > 0:
+                    dest_ptr = PyByteArray_AsString(data_buf)
+                    valid_ptr = PyByteArray_AsString(validity_buf)
+                    with nogil:
+                        null_count = numpy_export_copy_column(
+                            c_arrays, num_exported, col, width,
+                            <void*>dest_ptr, <uint8_t*>valid_ptr
+                        )
+                    if null_count < 0:
+                        raise RuntimeError(
+                            f"Unexpected Arrow layout for column '{names[col]}'"
+                        )
+
+                arr = np.frombuffer(data_buf, dtype=dtype)
+                if null_count > 0:
+                    valid = np.frombuffer(validity_buf, dtype=np.bool_)
+                    arr = np.ma.masked_array(arr, mask=~valid)
+                columns[names[col]] = arr
+        finally:
+            if c_arrays != NULL:
+                release_exported_arrays(c_arrays, num_exported)
+                free(c_arrays)
+            consumed_arrays_free(consumed_arrays)
+
+        # Free the DuckDB result early - the NumPy buffers own copies
+        if self._result != NULL:
+            with nogil:
+                destroy_query_result(self._result)
+            self._result = NULL
+
+        return columns
+
     def _to_arrow_stream(self):
         """
         Convert QueryResult to PyArrow Table (STREAM mode).
@@ -445,6 +689,7 @@ cdef class _ResultBase:
 
         cdef void* stream = NULL
         cdef ArrowQueryResult* arrow_result = NULL
+        cdef const char* parallel_err = NULL
 
         if self._physical_arrow_collector:
             _logger.debug("Using PhysicalArrowCollector path (pre-computed Arrow arrays)")
@@ -458,6 +703,40 @@ cdef class _ResultBase:
             with nogil:
                 stream = create_arrow_array_stream_from_arrow_result(arrow_result)
             _logger.debug("Created stream from ArrowQueryResult")
+        elif self._collector_mode_internal == "stream_parallel":
+            # Parallel conversion path: chunks of the materialized result are
+            # converted to Arrow on a worker pool and emitted in batch order.
+            # The helper owns (and promptly frees) the DuckDB result.
+            _logger.debug("Using parallel conversion path (materialized result)")
+            with nogil:
+                stream = create_parallel_arrow_array_stream(self._result, self._batch_size)
+            self._result = NULL  # owned by the helper even on failure
+            if stream == NULL:
+                parallel_err = parallel_stream_last_error()
+                if parallel_err != NULL:
+                    raise RuntimeError(
+                        "Failed to create parallel ArrowArrayStream: "
+                        + parallel_err.decode("utf-8")
+                    )
+                raise RuntimeError("Failed to create parallel ArrowArrayStream")
+            _logger.debug("Created parallel ArrowArrayStream")
+        elif self._collector_mode_internal == "stream_prefetch":
+            # Prefetching streaming path: a background thread fetches chunks
+            # ahead of the consumer, overlapping DuckDB execution with
+            # Python-side processing
+            _logger.debug("Using prefetching streaming path (background chunk fetching)")
+            with nogil:
+                stream = create_prefetching_arrow_array_stream(self._result, self._batch_size)
+            _logger.debug("Created prefetching ArrowArrayStream")
+        elif self._batch_bytes > 0:
+            # Adaptive streaming path: the first chunk calibrates bytes per
+            # row, then batch sizes track the requested byte footprint
+            _logger.debug("Using adaptive streaming path (target %d bytes/batch)", self._batch_bytes)
+            with nogil:
+                stream = create_streaming_arrow_array_stream_adaptive(
+                    self._result, self._batch_size, self._batch_bytes
+                )
+            _logger.debug("Created adaptive streaming ArrowArrayStream")
         else:
             # Streaming path: Create stream using QueryResultChunkScanState
             # This provides true streaming with on-demand chunk fetching
@@ -469,6 +748,10 @@ cdef class _ResultBase:
         if stream == NULL:
             raise RuntimeError("Failed to create ArrowArrayStream")
 
+        # Charge in-flight streaming batches to the connection; a no-op for
+        # stream types without accounting support (materialized/parallel)
+        streaming_stream_set_accounting(stream, self._mem_accounting)
+
         # DON'T free the DuckDB result - the stream now owns it and will handle cleanup
         # Set to NULL so __dealloc__ doesn't try to free it
         self._result = NULL
@@ -486,6 +769,9 @@ cdef class _ResultBase:
             with nogil:
                 destroy_query_result(self._result)
             self._result = NULL
+        if self._mem_accounting != NULL:
+            memory_accounting_destroy(self._mem_accounting)
+            self._mem_accounting = NULL
 
     def __repr__(self):
         """String representation."""
@@ -495,3 +781,144 @@ cdef class _ResultBase:
             return "<Result(empty)>"
         else:
             return "<Result(ready)>"
+
+
+cdef class PendingQueryImpl:
+    """
+    Incrementally executed query via DuckDB's pending-query API.
+
+    poll() runs one execution task unit at a time, so an asyncio event loop
+    can interleave many in-flight queries on one thread instead of blocking
+    a worker thread per query. get_result() finalizes into a _ResultBase.
+    """
+
+    def __cinit__(self):
+        self._pending = NULL
+        self._batch_size = 0
+        self._collector_mode_internal = "arrow"
+        self._finished = False
+        self._connection = None
+
+    @staticmethod
+    cdef PendingQueryImpl create(
+        ConnectionImpl connection, str query, uint64_t batch_size, str mode
+    ):
+        """
+        Launch a query without executing it to completion.
+
+        Args:
+            connection: DuckDB connection
+            query: SQL query string
+            batch_size: Arrow record batch size
+            mode: Execution mode ("arrow" or "stream")
+        """
+        cdef PendingQueryImpl pending = PendingQueryImpl()
+        pending._batch_size = batch_size
+        pending._collector_mode_internal = mode
+        pending._connection = connection
+
+        cdef bool use_arrow_collector = mode != "stream"
+        cdef bytes query_bytes = query.encode("utf-8")
+        cdef const char* c_query = query_bytes
+
+        with nogil:
+            pending._pending = pending_query_create(
+                connection._conn, c_query, batch_size, use_arrow_collector
+            )
+
+        if pending._pending == NULL:
+            raise RuntimeError("Failed to launch pending query")
+
+        return pending
+
+    def poll(self):
+        """
+        Execute one unit of work.
+
+        Returns True once the result is ready, False if more work remains.
+
+        Raises:
+            RuntimeError: If execution failed
+        """
+        if self._pending == NULL:
+            raise RuntimeError("Pending query is closed")
+
+        if self._finished:
+            return True
+
+        cdef int status
+        with nogil:
+            status = pending_query_poll(self._pending)
+
+        if status == 2:
+            error_msg = pending_query_error(self._pending)
+            error_str = error_msg.decode("utf-8") if error_msg else "Unknown error"
+            self.close()
+            raise RuntimeError(f"Query failed: {error_str}")
+
+        if status == 1:
+            self._finished = True
+            return True
+
+        return False
+
+    def get_result(self):
+        """
+        Finalize the pending query and return a _ResultBase.
+
+        Runs any remaining work synchronously - call poll() until it returns
+        True first for cooperative execution.
+        """
+        if self._pending == NULL:
+            raise RuntimeError("Pending query is closed")
+
+        cdef _ResultBase result = _ResultBase()
+        result._batch_size = self._batch_size
+        result._collector_mode_internal = self._collector_mode_internal
+        result._physical_arrow_collector = self._collector_mode_internal != "stream"
+
+        cdef QueryResult* query_result
+        with nogil:
+            query_result = pending_query_get_result(self._pending)
+
+        if query_result == NULL:
+            error_msg = pending_query_error(self._pending)
+            error_str = error_msg.decode("utf-8") if error_msg else "Unknown error"
+            self.close()
+            raise RuntimeError(f"Query failed: {error_str}")
+
+        self.close()
+
+        if result_has_error(query_result):
+            error_msg = result_get_error(query_result)
+            error_str = error_msg.decode("utf-8") if error_msg else "Unknown error"
+            destroy_query_result(query_result)
+            raise RuntimeError(f"Query failed: {error_str}")
+
+        result._result = query_result
+        return result
+
+    def close(self):
+        """Release the pending query state."""
+        if self._pending != NULL:
+            with nogil:
+                pending_query_destroy(self._pending)
+            self._pending = NULL
+
+    @property
+    def finished(self):
+        return self._finished
+
+    def __dealloc__(self):
+        if self._pending != NULL:
+            with nogil:
+                pending_query_destroy(self._pending)
+            self._pending = NULL
+
+    def __repr__(self):
+        if self._pending == NULL:
+            return "<PendingQuery(closed)>"
+        elif self._finished:
+            return "<PendingQuery(ready)>"
+        else:
+            return "<PendingQuery(running)>"
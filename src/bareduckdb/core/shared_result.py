@@ -0,0 +1,123 @@
+"""
+Zero-copy result handoff between processes via Arrow IPC over shared memory.
+
+Batches are written once to a memory-mapped Arrow IPC file (defaulting to
+/dev/shm so the buffers never touch disk); sibling processes map the file and
+reconstruct the batches zero-copy through pyarrow's mmap reader. The IPC file
+footer acts as the batch index, so a consumer can open any batch without
+scanning and without touching the producing process.
+"""
+
+from __future__ import annotations
+
+import logging
+import os
+import tempfile
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from typing import Any
+
+    import pyarrow as pa
+
+logger = logging.getLogger(__name__)
+
+_SHM_DIR = "/dev/shm"
+
+
+def _default_path() -> str:
+    directory = _SHM_DIR if os.path.isdir(_SHM_DIR) else None
+    fd, path = tempfile.mkstemp(suffix=".arrow", prefix="bareduckdb_", dir=directory)
+    os.close(fd)
+    return path
+
+
+def write_shared_result(data: Any, path: str | None = None) -> str:
+    """
+    Write Arrow data to a shared-memory-backed IPC file.
+
+    Args:
+        data: pa.Table, pa.RecordBatchReader, or any object implementing
+            __arrow_c_stream__
+        path: Target file path; defaults to a fresh file in /dev/shm
+            (falls back to the system temp dir)
+
+    Returns:
+        Path of the written segment - hand this to the consumer process
+    """
+    import pyarrow as pa
+
+    if path is None:
+        path = _default_path()
+
+    if isinstance(data, pa.Table):
+        reader = None
+        table = data
+    elif isinstance(data, pa.RecordBatchReader):
+        reader = data
+        table = None
+    elif hasattr(data, "__arrow_c_stream__"):
+        reader = pa.RecordBatchReader.from_stream(data)
+        table = None
+    else:
+        # Assume a raw stream capsule
+        reader = pa.RecordBatchReader._import_from_c_capsule(data)
+        table = None
+
+    schema = table.schema if table is not None else reader.schema
+
+    with pa.OSFile(path, "wb") as sink:
+        with pa.ipc.new_file(sink, schema) as writer:
+            if table is not None:
+                writer.write_table(table)
+            else:
+                for batch in reader:
+                    writer.write_batch(batch)
+
+    logger.debug("Wrote shared result segment: %s (%d bytes)", path, os.path.getsize(path))
+    return path
+
+
+def read_shared_result(path: str) -> pa.Table:
+    """
+    Map a shared result segment and reconstruct it zero-copy.
+
+    The returned table's buffers reference the mapped file directly; no
+    copy is made and the producing process is never involved.
+
+    Args:
+        path: Path returned by write_shared_result (possibly from another
+            process)
+    """
+    import pyarrow as pa
+
+    source = pa.memory_map(path, "r")
+    reader = pa.ipc.open_file(source)
+    return reader.read_all()
+
+
+def read_shared_result_reader(path: str) -> pa.RecordBatchReader:
+    """
+    Map a shared result segment as a RecordBatchReader.
+
+    Batches are produced zero-copy from the mapped file in footer-index
+    order.
+    """
+    import pyarrow as pa
+
+    source = pa.memory_map(path, "r")
+    file_reader = pa.ipc.open_file(source)
+
+    def batches():
+        for i in range(file_reader.num_record_batches):
+            yield file_reader.get_batch(i)
+
+    return pa.RecordBatchReader.from_batches(file_reader.schema, batches())
+
+
+def free_shared_result(path: str) -> None:
+    """Remove a shared result segment once all consumers are done with it."""
+    try:
+        os.unlink(path)
+    except FileNotFoundError:
+        pass
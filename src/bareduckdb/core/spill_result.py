@@ -0,0 +1,99 @@
+"""
+Bounded-memory materialization via spill-to-disk Arrow IPC.
+
+Batches stream out of DuckDB and accumulate in memory only until they pass
+a byte threshold; after that every batch (including the buffered ones) goes
+to a temp Arrow IPC file instead. The finished file is memory-mapped and
+reconstructed zero-copy, so the returned table behaves like a normal
+materialized result while peak heap usage stays near the threshold. The
+temp file is unlinked as soon as the mapping is open - the mapping keeps
+the data alive and nothing is left behind.
+"""
+
+from __future__ import annotations
+
+import logging
+import os
+import tempfile
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    import pyarrow as pa
+
+logger = logging.getLogger(__name__)
+
+
+def materialize_with_spill(
+    reader: "pa.RecordBatchReader",
+    threshold_bytes: int,
+    spill_dir: str | None = None,
+) -> "pa.Table":
+    """
+    Drain a RecordBatchReader into a table with bounded heap usage.
+
+    Args:
+        reader: Source batches (consumed fully)
+        threshold_bytes: In-memory budget; once buffered batches exceed it,
+            collection switches to an Arrow IPC temp file
+        spill_dir: Directory for the spill file (defaults to the system
+            temp dir - unlike shared results, spills belong on real disk)
+
+    Returns:
+        pa.Table - in-memory if the result stayed under the threshold,
+        otherwise backed zero-copy by the memory-mapped spill file
+    """
+    import pyarrow as pa
+
+    batches: list[pa.RecordBatch] = []
+    buffered_bytes = 0
+    writer = None
+    sink = None
+    path: str | None = None
+
+    try:
+        for batch in reader:
+            if writer is None:
+                batches.append(batch)
+                buffered_bytes += batch.nbytes
+                if buffered_bytes <= threshold_bytes:
+                    continue
+
+                # Threshold crossed - open the spill file and flush
+                # everything buffered so far
+                fd, path = tempfile.mkstemp(suffix=".arrow", prefix="bareduckdb_spill_", dir=spill_dir)
+                os.close(fd)
+                sink = pa.OSFile(path, "wb")
+                writer = pa.ipc.new_file(sink, reader.schema)
+                for buffered in batches:
+                    writer.write_batch(buffered)
+                batches = []
+                logger.debug("Result passed %d-byte threshold; spilling to %s", threshold_bytes, path)
+            else:
+                writer.write_batch(batch)
+
+        if writer is None:
+            return pa.Table.from_batches(batches, schema=reader.schema)
+
+        writer.close()
+        writer = None
+        sink.close()
+        sink = None
+        logger.debug("Spill complete: %s (%d bytes)", path, os.path.getsize(path))
+
+        source = pa.memory_map(path, "r")
+        table = pa.ipc.open_file(source).read_all()
+
+        # The mapping keeps the pages alive; unlink now so no file leaks
+        os.unlink(path)
+        path = None
+        return table
+    finally:
+        if writer is not None:
+            writer.close()
+        if sink is not None:
+            sink.close()
+        if path is not None:
+            try:
+                os.unlink(path)
+            except FileNotFoundError:
+                pass
@@ -65,6 +65,55 @@ class ArrowHolder(DataHolder):
         reader = scanner.to_reader()
         return reader.__arrow_c_stream__()
 
+    # Partitions smaller than this aren't worth the per-stream overhead
+    _MIN_ROWS_PER_PARTITION = 122_880  # 60 DuckDB vectors
+
+    def produce_filtered_partitioned(
+        self,
+        projected_columns: list[str] | None,
+        filters: dict[int, dict[str, Any]] | None,
+        max_partitions: int,
+    ) -> list[Any] | None:
+        """
+        Split an in-memory table into independent partition streams.
+
+        Returns a list of ArrowArrayStream capsules (one per slice), or None to
+        fall back to the single-stream ``produce_filtered`` path. Filtered scans
+        fall back so the dataset scanner keeps applying pushdown.
+        """
+        if self._table is None or filters:
+            return None
+        if projected_columns is None and filters is None:
+            # Schema-only probe - no point partitioning an empty stream
+            return None
+
+        table = self._table
+        if projected_columns:
+            table = table.select(projected_columns)
+
+        num_partitions = min(
+            max_partitions,
+            max(1, table.num_rows // self._MIN_ROWS_PER_PARTITION),
+        )
+        if num_partitions <= 1:
+            return None
+
+        rows_per_partition = -(-table.num_rows // num_partitions)  # ceil div
+        capsules = []
+        for start in range(0, table.num_rows, rows_per_partition):
+            capsules.append(table.slice(start, rows_per_partition).__arrow_c_stream__())
+        return capsules
+
+    def produce_full_streams(self, count: int) -> list[Any] | None:
+        """
+        Export ``count`` independent full-table streams for registration-time
+        pre-export. Returns None for lazy datasets, where a full scan would
+        materialize data eagerly.
+        """
+        if self._table is None:
+            return None
+        return [self._table.__arrow_c_stream__() for _ in range(count)]
+
     def compute_statistics(self, columns: list[str] | bool) -> list[tuple]:
         # Only compute statistics for in-memory tables, not lazy datasets
         if self._table is None:
@@ -88,6 +137,7 @@ class _FilterType:
     OPTIONAL_FILTER = 6
     IN_FILTER = 7
     DYNAMIC_FILTER = 8
+    EXPRESSION_FILTER = 9
 
 
 class _ComparisonType:
@@ -223,7 +273,13 @@ def _translate_single_filter(
         return result
 
     elif filter_type == _FilterType.IN_FILTER:
-        values = filter_info.get("values", [])
+        values = filter_info.get("values")
+        if values is None and "values_kind" in filter_info:
+            arr = _in_buffer_to_array(filter_info, column_type)
+            if arr is not None:
+                return field.isin(arr)
+            # Column needs per-element conversion (date/timestamp)
+            values = _in_buffer_to_pylist(filter_info)
         if not values:
             return ds.scalar(False)
         converted_values = [_convert_value_for_type(v, column_type) for v in values]
@@ -237,10 +293,54 @@ def _translate_single_filter(
     elif filter_type == _FilterType.OPTIONAL_FILTER:
         return ds.scalar(True)
 
+    elif filter_type == _FilterType.EXPRESSION_FILTER:
+        # Expression trees are translated for Polars holders; dataset
+        # expressions have no equivalent here, so pass through and let
+        # DuckDB evaluate the filter
+        return ds.scalar(True)
+
     else:
         return ds.scalar(True)
 
 
+def _in_buffer_to_array(filter_info: dict[str, Any], column_type: pa.DataType) -> pa.Array | None:
+    """
+    Rebuild a packed IN-list buffer as one Arrow array without touching the
+    elements (the bytes objects from the Cython layer back the array
+    zero-copy). Returns None when the column type needs per-element
+    conversion instead.
+    """
+    kind = filter_info["values_kind"]
+    n = filter_info["values_count"]
+    buf = pa.py_buffer(filter_info["values_buffer"])
+
+    if kind == "int64" and pa.types.is_integer(column_type):
+        arr = pa.Array.from_buffers(pa.int64(), n, [None, buf])
+        return arr if column_type == pa.int64() else arr.cast(column_type)
+    if kind == "float64" and pa.types.is_floating(column_type):
+        arr = pa.Array.from_buffers(pa.float64(), n, [None, buf])
+        return arr if column_type == pa.float64() else arr.cast(column_type)
+    if kind == "string" and (pa.types.is_string(column_type) or pa.types.is_large_string(column_type)):
+        offsets = pa.py_buffer(filter_info["values_offsets"])
+        arr = pa.Array.from_buffers(pa.string(), n, [None, offsets, buf])
+        return arr if column_type == pa.string() else arr.cast(column_type)
+    return None
+
+
+def _in_buffer_to_pylist(filter_info: dict[str, Any]) -> list:
+    """Unpack a buffered IN-list into Python values (date/timestamp columns)."""
+    import array as _array
+
+    kind = filter_info["values_kind"]
+    buf = filter_info["values_buffer"]
+    if kind == "int64":
+        return _array.array("q", buf).tolist()
+    if kind == "float64":
+        return _array.array("d", buf).tolist()
+    offsets = _array.array("i", filter_info["values_offsets"])
+    return [buf[offsets[i] : offsets[i + 1]].decode("utf-8") for i in range(len(offsets) - 1)]
+
+
 def _convert_value_for_type(value: Any, column_type: pa.DataType) -> Any:
     import datetime
 
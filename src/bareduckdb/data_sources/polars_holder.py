@@ -157,6 +157,38 @@ class _FilterType:
     OPTIONAL_FILTER = 6
     IN_FILTER = 7
     DYNAMIC_FILTER = 8
+    EXPRESSION_FILTER = 9
+
+
+# Expression-tree node kinds (match HOLDER_EXPR_* in filter_types.hpp)
+class _ExprOp:
+    COLUMN = 1
+    CONST = 2
+    COMPARE = 3
+    ADD = 4
+    SUB = 5
+    MUL = 6
+    PREFIX = 7
+    SUFFIX = 8
+    CONTAINS = 9
+    DATE_TRUNC = 10
+    AND = 11
+    OR = 12
+
+
+# DuckDB date_trunc parts -> Polars truncate intervals
+_DATE_TRUNC_EVERY = {
+    "year": "1y",
+    "quarter": "1q",
+    "month": "1mo",
+    "week": "1w",
+    "day": "1d",
+    "hour": "1h",
+    "minute": "1m",
+    "second": "1s",
+    "millisecond": "1ms",
+    "microsecond": "1us",
+}
 
 
 # Comparison type constants (match DuckDB ExpressionType enum)
@@ -169,6 +201,20 @@ class _ComparisonType:
     GREATER_THAN_OR_EQUAL = 30
 
 
+def _unpack_in_buffer(filter_info: dict[str, Any]) -> list:
+    """Unpack a contiguous typed IN-list buffer into values for is_in."""
+    import array as _array
+
+    kind = filter_info["values_kind"]
+    buf = filter_info["values_buffer"]
+    if kind == "int64":
+        return _array.array("q", buf).tolist()
+    if kind == "float64":
+        return _array.array("d", buf).tolist()
+    offsets = _array.array("i", filter_info["values_offsets"])
+    return [buf[offsets[i] : offsets[i + 1]].decode("utf-8") for i in range(len(offsets) - 1)]
+
+
 def _translate_filters_to_polars(
     filters: dict[int, dict[str, Any]],
     column_names: list[str],
@@ -248,11 +294,21 @@ def _translate_single_filter(
         return pl.lit(True)
 
     elif filter_type == _FilterType.IN_FILTER:
-        values = filter_info.get("values", [])
+        values = filter_info.get("values")
+        if values is None and "values_kind" in filter_info:
+            values = _unpack_in_buffer(filter_info)
         if not values:
             return pl.lit(False)
         return col.is_in(values)
 
+    elif filter_type == _FilterType.EXPRESSION_FILTER:
+        expr_info = filter_info.get("expr")
+        if expr_info is None:
+            # Expression used vocabulary the converter doesn't cover;
+            # DuckDB still evaluates the filter itself
+            return pl.lit(True)
+        return _translate_expr_tree(expr_info, col)
+
     elif filter_type == _FilterType.DYNAMIC_FILTER:
         return pl.lit(True)
 
@@ -263,6 +319,69 @@ def _translate_single_filter(
         return pl.lit(True)
 
 
+def _translate_expr_tree(expr_info: dict[str, Any], col: pl.Expr) -> pl.Expr:
+    """Translate an expression-filter tree (date_trunc buckets, arithmetic,
+    anchored string matches) to a Polars expression. Raises for nodes it
+    can't handle; the caller skips the filter, which is safe because DuckDB
+    re-applies pushed filters it can't prove were fully absorbed."""
+    op = expr_info["op"]
+    children = expr_info.get("children", [])
+
+    if op == _ExprOp.COLUMN:
+        return col
+
+    if op == _ExprOp.CONST:
+        return pl.lit(expr_info["value"])
+
+    if op == _ExprOp.COMPARE:
+        lhs = _translate_expr_tree(children[0], col)
+        rhs_info = children[1]
+        if rhs_info["op"] == _ExprOp.CONST:
+            # Plain value keeps the NaN special-casing in _apply_comparison
+            value = rhs_info["value"]
+            if isinstance(value, float) and math.isnan(value):
+                return _translate_nan_comparison(expr_info["comparison"], lhs)
+            return _apply_comparison(lhs, expr_info["comparison"], value)
+        return _apply_comparison(lhs, expr_info["comparison"], _translate_expr_tree(rhs_info, col))
+
+    if op == _ExprOp.ADD:
+        return _translate_expr_tree(children[0], col) + _translate_expr_tree(children[1], col)
+
+    if op == _ExprOp.SUB:
+        return _translate_expr_tree(children[0], col) - _translate_expr_tree(children[1], col)
+
+    if op == _ExprOp.MUL:
+        return _translate_expr_tree(children[0], col) * _translate_expr_tree(children[1], col)
+
+    if op == _ExprOp.PREFIX:
+        return _translate_expr_tree(children[0], col).str.starts_with(expr_info["aux"])
+
+    if op == _ExprOp.SUFFIX:
+        return _translate_expr_tree(children[0], col).str.ends_with(expr_info["aux"])
+
+    if op == _ExprOp.CONTAINS:
+        return _translate_expr_tree(children[0], col).str.contains(expr_info["aux"], literal=True)
+
+    if op == _ExprOp.DATE_TRUNC:
+        # KeyError on an unmapped part skips the filter
+        every = _DATE_TRUNC_EVERY[expr_info["aux"].lower()]
+        return _translate_expr_tree(children[0], col).dt.truncate(every)
+
+    if op == _ExprOp.AND:
+        result = _translate_expr_tree(children[0], col)
+        for child in children[1:]:
+            result = result & _translate_expr_tree(child, col)
+        return result
+
+    if op == _ExprOp.OR:
+        result = _translate_expr_tree(children[0], col)
+        for child in children[1:]:
+            result = result | _translate_expr_tree(child, col)
+        return result
+
+    raise ValueError(f"Unsupported expression op: {op}")
+
+
 def _translate_nan_comparison(comparison: int, col: pl.Expr) -> pl.Expr:
     """Handle comparisons with NaN value."""
     if comparison == _ComparisonType.EQUAL:
@@ -3,10 +3,12 @@ Bareduckdb Dataset Module.
 
 Provides data registration functionality:
 - register_table() - Register PyArrow Tables, Polars DataFrames, and Pandas DataFrames
+- register_tables() - Batch variant; all views created in one catalog transaction
 """
 
-from bareduckdb.dataset.backend import register_table
+from bareduckdb.dataset.backend import register_table, register_tables
 
 __all__ = [
     "register_table",
+    "register_tables",
 ]
@@ -76,6 +76,16 @@ def register_table(
 
     conn_impl = _get_connection_impl(connection_base)
 
+    # Any (re)registration invalidates cached query results
+    if hasattr(connection_base, "_bump_registration_version"):
+        connection_base._bump_registration_version()
+
+    # Re-registering a growing table: swap the holder in place when the
+    # existing factory matches, skipping catalog churn and schema re-fetch
+    if replace and _try_update_holder(connection_base, name, holder, statistics):
+        logger.debug("Updated '%s' in place via update_holder", name)
+        return True
+
     with _data_source_registration_lock:
         if not hasattr(connection_base, "_python_data_functions_registered"):
             try:
@@ -106,11 +116,164 @@ def register_table(
     )
 
     connection_base._holder_factories[name] = (factory_ptr, holder)
+    _preexport_full_streams(factory_ptr, holder)
 
     logger.debug("Registered %s as '%s' via unified DataHolder", type(data).__name__, name)
     return True
 
 
+def register_tables(
+    connection_base: "ConnectionBase",
+    items: dict[str, object],
+    *,
+    replace: bool = True,
+    statistics: StatisticsType = None,
+) -> list[str]:
+    """
+    Register several data sources in one batch.
+
+    Same semantics per entry as register_table, but all new views are
+    created through a single catalog transaction, so registering N objects
+    pays the catalog/transaction overhead once instead of N times. Entries
+    whose name already has a matching holder registration are still swapped
+    in place individually (that path touches no catalog state).
+
+    Args:
+        connection_base: The database connection
+        items: Mapping of view name to data source
+        replace: If True, replace existing tables (default True)
+        statistics: Same statistics specification as register_table,
+            applied to every entry
+
+    Returns:
+        List of names that were NOT holder-registrable; the caller decides
+        how to register those (e.g. the capsule-based fallback)
+    """
+    from bareduckdb.common.impl.holder_scan import (
+        delete_holder_factory_pyx,
+        register_holders_batch_pyx,
+        register_scan_function_pyx,
+    )
+    from bareduckdb.data_sources import get_holder
+
+    try:
+        from bareduckdb.data_sources.polars_holder import PolarsHolder, PolarsLazyHolder
+
+        _polars_holder_types = (PolarsHolder, PolarsLazyHolder)
+    except ImportError:
+        _polars_holder_types = ()
+
+    conn_impl = _get_connection_impl(connection_base)
+
+    if hasattr(connection_base, "_bump_registration_version"):
+        connection_base._bump_registration_version()
+
+    unsupported: list[str] = []
+    entries: list[tuple] = []
+    for name, data in items.items():
+        holder = get_holder(data)
+        if holder is None:
+            unsupported.append(name)
+            continue
+        if replace and _try_update_holder(connection_base, name, holder, statistics):
+            logger.debug("Updated '%s' in place via update_holder", name)
+            continue
+        stats_data = holder.compute_statistics(statistics) if statistics else None  # type: ignore
+        supports_views = isinstance(holder, _polars_holder_types) if _polars_holder_types else False
+        entries.append((name, holder, stats_data, supports_views))
+
+    if not entries:
+        return unsupported
+
+    with _data_source_registration_lock:
+        if not hasattr(connection_base, "_python_data_functions_registered"):
+            try:
+                register_scan_function_pyx(conn_impl, "python_data_scan")
+                connection_base._python_data_functions_registered = True
+            except RuntimeError as e:
+                if "already exists" not in str(e):
+                    raise
+                connection_base._python_data_functions_registered = True
+
+    if not hasattr(connection_base, "_holder_factories"):
+        connection_base._holder_factories = {}
+
+    if replace:
+        for name, _, _, _ in entries:
+            if name in connection_base._holder_factories:
+                old_factory_ptr, old_holder = connection_base._holder_factories.pop(name)
+                delete_holder_factory_pyx(conn_impl, old_factory_ptr, old_holder)
+
+    factory_ptrs = register_holders_batch_pyx(conn_impl, entries, replace)
+
+    for (name, holder, _, _), factory_ptr in zip(entries, factory_ptrs):
+        connection_base._holder_factories[name] = (factory_ptr, holder)
+        _preexport_full_streams(factory_ptr, holder)
+
+    logger.debug("Registered %d data sources in one batch", len(entries))
+    return unsupported
+
+
+# Streams pre-exported per registration; full scans beyond this count fall
+# back to the GIL-acquiring produce callback
+_PREEXPORT_STREAM_COUNT = 2
+
+
+def _preexport_full_streams(factory_ptr: int, holder: Any) -> None:
+    """
+    Hand the factory ready full-table streams so projection/filter-free scans
+    are served entirely in C++ without re-entering Python. Only holders that
+    can export the full table cheaply (in-memory Arrow) participate.
+    """
+    from bareduckdb.common.impl.holder_scan import add_preexported_stream_pyx
+
+    producer = getattr(holder, "produce_full_streams", None)
+    if producer is None:
+        return
+
+    try:
+        capsules = producer(_PREEXPORT_STREAM_COUNT)
+    except Exception as e:
+        logger.debug("Stream pre-export declined by %s: %s", type(holder).__name__, e)
+        return
+
+    for capsule in capsules or []:
+        add_preexported_stream_pyx(factory_ptr, capsule)
+
+
+def _try_update_holder(connection_base: "ConnectionBase", name: str, holder: Any, statistics: StatisticsType) -> bool:
+    """
+    Swap the data behind an existing holder registration in place.
+
+    Only applies when the name is already holder-registered with the same
+    holder type and column schema - anything else returns False and the
+    caller runs full registration.
+    """
+    from bareduckdb.common.impl.holder_scan import update_holder_pyx
+
+    factories = getattr(connection_base, "_holder_factories", None)
+    if not factories or name not in factories:
+        return False
+
+    factory_ptr, old_holder = factories[name]
+    if type(holder) is not type(old_holder):
+        return False
+    if list(holder.column_names) != list(old_holder.column_names):
+        return False
+    # Same names but changed column types must also fall back: the swap
+    # keeps the factory's cached Arrow schema, so a holder with a different
+    # layout would be decoded against the stale schema and return garbage
+    if not holder.schema.equals(old_holder.schema):
+        return False
+
+    stats_data = holder.compute_statistics(statistics) if statistics else None
+    update_holder_pyx(factory_ptr, holder, stats_data)
+    factories[name] = (factory_ptr, holder)
+    # The swap dropped the old holder's pre-exported streams; replenish
+    _preexport_full_streams(factory_ptr, holder)
+    return True
+
+
 def _get_column_names(data: SchemaData) -> list[str]:
     import pyarrow as pa
 
@@ -344,6 +507,11 @@ def _compute_statistics_arrow(table: "pa.Table", statistics: StatisticsType) ->
     import pyarrow as pa
     import pyarrow.compute as pc
 
+    try:
+        from bareduckdb.common.impl.holder_scan import compute_column_stats_pyx
+    except ImportError:
+        compute_column_stats_pyx = None
+
     if table.num_rows == 0:
         return []
 
@@ -364,6 +532,25 @@ def _compute_statistics_arrow(table: "pa.Table", statistics: StatisticsType) ->
         if field.type in (pa.string_view(), pa.binary_view()):
             continue
 
+        # Native kernel first: walks the Arrow buffers directly in C++ with
+        # the GIL released. Returns None for unsupported types (strings,
+        # NaN-containing floats, ...) which keep the pyarrow.compute path.
+        if compute_column_stats_pyx is not None:
+            try:
+                # Keep the capsule pairs alive for the duration of the call
+                capsule_pairs = [chunk.__arrow_c_array__() for chunk in col.chunks]
+                native = compute_column_stats_pyx(
+                    idx,
+                    field.type.__arrow_c_schema__(),
+                    [pair[1] for pair in capsule_pairs],
+                )
+            except Exception as e:
+                logger.debug("Native stats kernel failed for column '%s': %s", name, e)
+                native = None
+            if native is not None:
+                results.append(native)
+                continue
+
         null_count = col.null_count
         num_rows = len(col)
 
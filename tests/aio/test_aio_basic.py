@@ -19,3 +19,25 @@ async def test_multiple():
         assert len(results)==10
         assert len(results[-2]) == 8
 
+async def test_pending_single():
+    async with AsyncConnectionPool() as pool:
+        r = await pool.execute_pending("select * from range(10)")
+        assert len(r)==10
+
+async def test_pending_multiple():
+    async with AsyncConnectionPool(pool_size=2) as pool:
+
+        tasks = [pool.execute_pending(f"select count(*) c from range({(i + 1) * 1000})") for i in range(8)]
+
+        results = await asyncio.gather(*tasks)
+        assert [r.to_pylist()[0]["c"] for r in results] == [(i + 1) * 1000 for i in range(8)]
+
+async def test_pending_error():
+    async with AsyncConnectionPool() as pool:
+        with pytest.raises(RuntimeError):
+            await pool.execute_pending("select * from no_such_table")
+
+        # Pool still usable after a failed query
+        r = await pool.execute_pending("select 1 as x")
+        assert len(r)==1
+
@@ -0,0 +1,313 @@
+// Native microbenchmarks for the C++ hot paths behind the Python bindings:
+// Arrow export out of the collector, streaming chunk fetch, filter pushdown
+// conversion, the registration scan's Produce fast path, and SQL reference
+// extraction. Everything links against the same headers the extensions
+// compile, so a regression here shows up before the Python layer does.
+//
+// Python is initialized (without site/signal handlers) because the scan
+// headers embed the C API; no Python code runs inside timed regions except
+// where the measured path itself touches the GIL.
+
+#include <benchmark/benchmark.h>
+
+#include <Python.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cpp_helpers.hpp"
+#include "unified_data_scan.hpp"
+
+namespace
+{
+
+    // One in-memory database shared by every benchmark; connections are cheap
+    // but the database carries the buffer pool, so reuse keeps runs stable.
+    struct BenchDatabase
+    {
+        duckdb_database db = nullptr;
+        duckdb_connection conn = nullptr;
+
+        BenchDatabase()
+        {
+            if (duckdb_open(nullptr, &db) != DuckDBSuccess ||
+                duckdb_connect(db, &conn) != DuckDBSuccess)
+            {
+                throw std::runtime_error("failed to open in-memory duckdb");
+            }
+        }
+
+        ~BenchDatabase()
+        {
+            if (conn)
+            {
+                duckdb_disconnect(&conn);
+            }
+            if (db)
+            {
+                duckdb_close(&db);
+            }
+        }
+    };
+
+    duckdb_connection bench_connection()
+    {
+        static BenchDatabase instance;
+        return instance.conn;
+    }
+
+    std::string range_query(int64_t rows)
+    {
+        return "SELECT range AS i, range * 2 AS j, 'val_' || range AS s FROM range(" +
+               std::to_string(rows) + ")";
+    }
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// consumed_arrays_export_all: the materialized-result export used by
+// output_type="arrow_table". Execution runs outside the timed region; the
+// timed work is ConsumeArrays plus the bulk ownership transfer.
+// ---------------------------------------------------------------------------
+static void BM_ConsumedArraysExportAll(benchmark::State &state)
+{
+    const int64_t rows = state.range(0);
+    const std::string query = range_query(rows);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        duckdb::QueryResult *result = bareduckdb::execute_with_arrow_collector(
+            bench_connection(), query.c_str(), 122880, false);
+        duckdb::ArrowQueryResult *arrow_result = bareduckdb::cast_to_arrow_result(result);
+        if (!arrow_result)
+        {
+            state.SkipWithError("query did not produce an ArrowQueryResult");
+            break;
+        }
+        state.ResumeTiming();
+
+        void *consumed = bareduckdb::arrow_result_consume_arrays(arrow_result);
+        size_t count = bareduckdb::consumed_arrays_size(consumed);
+        std::vector<ArrowArray> arrays(count);
+        size_t exported = bareduckdb::consumed_arrays_export_all(consumed, arrays.data(), count);
+        benchmark::DoNotOptimize(exported);
+
+        state.PauseTiming();
+        bareduckdb::release_exported_arrays(arrays.data(), exported);
+        bareduckdb::consumed_arrays_free(consumed);
+        bareduckdb::destroy_query_result(result);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_ConsumedArraysExportAll)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// ---------------------------------------------------------------------------
+// fetch_arrow_chunk: the streaming path, swept across rows_per_batch to show
+// the per-chunk fixed cost (schema conversion, FetchChunk setup) against
+// batch size. 2048 is duckdb's vector-ish floor, 122880 is the default,
+// 1M approximates "one big batch".
+// ---------------------------------------------------------------------------
+static void BM_FetchArrowChunk(benchmark::State &state)
+{
+    const int64_t rows = 1000000;
+    const uint64_t rows_per_batch = static_cast<uint64_t>(state.range(0));
+    const std::string query = range_query(rows);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        duckdb::QueryResult *result = bareduckdb::execute_without_arrow_collector(
+            bench_connection(), query.c_str(), false);
+        void *stream_state = bareduckdb::init_streaming_arrow_state(result);
+        if (!stream_state)
+        {
+            state.SkipWithError("failed to init streaming state");
+            break;
+        }
+        state.ResumeTiming();
+
+        ArrowArray array;
+        ArrowSchema schema;
+        while (bareduckdb::fetch_arrow_chunk(stream_state, rows_per_batch, &array, &schema))
+        {
+            benchmark::DoNotOptimize(array.length);
+            if (array.release)
+            {
+                array.release(&array);
+            }
+            if (schema.release)
+            {
+                schema.release(&schema);
+            }
+        }
+
+        state.PauseTiming();
+        bareduckdb::free_streaming_arrow_state(stream_state);
+        bareduckdb::destroy_query_result(result);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_FetchArrowChunk)->Arg(2048)->Arg(10240)->Arg(122880)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+// ---------------------------------------------------------------------------
+// ConvertFilter with IN-lists: the arena-backed conversion that runs inside
+// every filtered Produce call. The arena is reset per iteration, matching the
+// steady state where slabs are already warm.
+// ---------------------------------------------------------------------------
+static void BM_ConvertFilterInList(benchmark::State &state)
+{
+    const int64_t n = state.range(0);
+    duckdb::vector<duckdb::Value> values;
+    for (int64_t i = 0; i < n; i++)
+    {
+        values.push_back(duckdb::Value::BIGINT(i * 7));
+    }
+    duckdb::InFilter filter(std::move(values));
+
+    bareduckdb::FilterArena arena;
+    for (auto _ : state)
+    {
+        arena.Reset();
+        bareduckdb::FilterBuilder builder(arena);
+        HolderFilterInfo *info = bareduckdb::ConvertFilter(&filter, builder);
+        benchmark::DoNotOptimize(info);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ConvertFilterInList)->Arg(8)->Arg(64)->Arg(1024)->Arg(16384)->Unit(benchmark::kMicrosecond);
+
+// ---------------------------------------------------------------------------
+// HolderFactory::Produce, pre-exported fast path: a full-projection scan that
+// should consume the registration-time stream without touching the GIL. The
+// stream itself is built outside the timed region; the timed work is the
+// projection match plus the handoff.
+// ---------------------------------------------------------------------------
+static void BM_HolderFactoryProducePreexported(benchmark::State &state)
+{
+    const std::vector<std::string> columns = {"i", "j", "s"};
+    const std::string query = range_query(100000);
+
+    bareduckdb::HolderFactory factory(
+        nullptr, nullptr, nullptr, nullptr, columns, 100000, 0, nullptr, false);
+
+    duckdb::ArrowStreamParameters params;
+    params.filters = nullptr;
+    for (size_t c = 0; c < columns.size(); c++)
+    {
+        params.projected_columns.projection_map[c] = columns[c];
+        params.projected_columns.columns.push_back(columns[c]);
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        duckdb::QueryResult *result = bareduckdb::execute_with_arrow_collector(
+            bench_connection(), query.c_str(), 122880, false);
+        auto *stream = static_cast<ArrowArrayStream *>(
+            bareduckdb::create_arrow_array_stream_from_arrow_result(
+                bareduckdb::cast_to_arrow_result(result)));
+        if (!stream)
+        {
+            state.SkipWithError("failed to build pre-exported stream");
+            break;
+        }
+        // Stand-in for the capsule the Python side would attach; the factory
+        // dtor balances this with a Py_DECREF
+        Py_INCREF(Py_None);
+        factory.AddPreexportedStream(stream, Py_None);
+        state.ResumeTiming();
+
+        auto wrapper = bareduckdb::HolderFactory::Produce(
+            reinterpret_cast<uintptr_t>(&factory), params);
+        benchmark::DoNotOptimize(wrapper.get());
+
+        state.PauseTiming();
+        wrapper.reset();
+        delete stream; // contents were moved into the wrapper
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_HolderFactoryProducePreexported)->Unit(benchmark::kNanosecond);
+
+// ---------------------------------------------------------------------------
+// parse_sql_extract_refs on a representative corpus. The cached variant
+// measures the steady state (the LRU holds the corpus); the uncached variant
+// defeats the cache with a per-iteration suffix to time the parse itself.
+// ---------------------------------------------------------------------------
+namespace
+{
+    const std::vector<std::string> &query_corpus()
+    {
+        static const std::vector<std::string> corpus = {
+            "SELECT * FROM lineitem",
+            "SELECT a, b FROM t1 JOIN t2 ON t1.id = t2.id JOIN t3 USING (k) WHERE t3.x > 5",
+            "WITH recent AS (SELECT * FROM events WHERE ts > now() - INTERVAL 1 DAY) "
+            "SELECT user_id, count(*) FROM recent GROUP BY user_id",
+            "SELECT * FROM (SELECT i FROM (SELECT range AS i FROM range(10)) sub1) sub2 "
+            "WHERE i IN (SELECT j FROM other)",
+            "INSERT INTO target SELECT s.a, read_csv('data.csv').b FROM source s",
+        };
+        return corpus;
+    }
+} // namespace
+
+static void BM_ParseSqlExtractRefsCached(benchmark::State &state)
+{
+    const auto &corpus = query_corpus();
+    // Warm the parse cache so every timed parse is a hit
+    for (const auto &q : corpus)
+    {
+        bareduckdb::parse_sql_extract_refs(q.c_str());
+    }
+    for (auto _ : state)
+    {
+        for (const auto &q : corpus)
+        {
+            auto info = bareduckdb::parse_sql_extract_refs(q.c_str());
+            benchmark::DoNotOptimize(info.table_refs.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_ParseSqlExtractRefsCached)->Unit(benchmark::kMicrosecond);
+
+static void BM_ParseSqlExtractRefsUncached(benchmark::State &state)
+{
+    const auto &corpus = query_corpus();
+    uint64_t salt = 0;
+    for (auto _ : state)
+    {
+        for (const auto &q : corpus)
+        {
+            // Unique trailing comment keeps the cache cold without changing
+            // what the parser has to do
+            std::string unique = q + " -- " + std::to_string(salt++);
+            auto info = bareduckdb::parse_sql_extract_refs(unique.c_str());
+            benchmark::DoNotOptimize(info.table_refs.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_ParseSqlExtractRefsUncached)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char **argv)
+{
+    // No site, no signal handlers - just enough interpreter for the headers
+    Py_InitializeEx(0);
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        Py_Finalize();
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+    Py_Finalize();
+    return 0;
+}
@@ -0,0 +1,61 @@
+"""Warm cursor connection pool: closed cursors park their connection for
+reuse by the next cursor() call, after a session reset."""
+
+import bareduckdb
+
+
+def test_closed_cursor_returns_to_pool():
+    conn = bareduckdb.connect()
+    assert conn._impl.pool_idle_count == 0
+
+    cursor = conn.cursor()
+    cursor.execute("SELECT 1")
+    cursor.close()
+    assert conn._impl.pool_idle_count == 1
+
+    # Next cursor reuses the warm connection
+    cursor2 = conn.cursor()
+    assert conn._impl.pool_idle_count == 0
+    result = cursor2.execute("SELECT 42").arrow_table()
+    assert result.column(0).to_pylist() == [42]
+
+
+def test_pooled_cursor_session_is_reset():
+    conn = bareduckdb.connect()
+
+    cursor = conn.cursor()
+    cursor.execute("CREATE TEMP TABLE scratch AS SELECT 1 AS a")
+    cursor.execute("SET threads = 1")
+    cursor.close()
+
+    # Reused connection must not see the previous session's temp objects
+    # or settings
+    cursor2 = conn.cursor()
+    result = cursor2.execute(
+        "SELECT count(*) FROM duckdb_tables() WHERE table_name = 'scratch'"
+    ).arrow_table()
+    assert result.column(0).to_pylist() == [0]
+
+
+def test_pooled_cursor_still_shares_tables():
+    conn = bareduckdb.connect()
+    conn.execute("CREATE TABLE pool_shared (id INTEGER)")
+    conn.execute("INSERT INTO pool_shared VALUES (1), (2)")
+
+    cursor = conn.cursor()
+    cursor.close()
+
+    cursor2 = conn.cursor()
+    result = cursor2.execute("SELECT count(*) FROM pool_shared").arrow_table()
+    assert result.column(0).to_pylist() == [2]
+
+
+def test_many_cursor_cycles_bounded_pool():
+    conn = bareduckdb.connect()
+    for _ in range(20):
+        cursor = conn.cursor()
+        cursor.execute("SELECT 1")
+        cursor.close()
+
+    # Sequential open/close never grows the pool past one idle connection
+    assert conn._impl.pool_idle_count == 1
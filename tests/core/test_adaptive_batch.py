@@ -0,0 +1,62 @@
+import pytest
+from bareduckdb.core import ConnectionBase
+
+
+def test_adaptive_roundtrip(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    reader = conn._call(
+        query="select * from range(500000) t(i)",
+        output_type="arrow_reader",
+        batch_bytes=1_000_000,
+    )
+    table = reader.read_all()
+
+    assert len(table) == 500_000
+    assert table.column("i")[0].as_py() == 0
+    assert table.column("i")[-1].as_py() == 499_999
+    conn.close()
+
+
+def test_adaptive_matches_fixed_batches(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    query = "select i, 'val_' || i as s from range(100000) t(i)"
+    fixed = conn._call(query=query, output_type="arrow_reader").read_all()
+    adaptive = conn._call(query=query, output_type="arrow_reader", batch_bytes=512_000).read_all()
+
+    assert fixed.to_pylist() == adaptive.to_pylist()
+    conn.close()
+
+
+def test_adaptive_resizes_after_first_chunk(make_connection, connect_config, thread_index, iteration_index):
+    # A tiny initial batch plus a byte target means the batches after the
+    # first should grow toward the target instead of staying at batch_size
+    conn = make_connection(thread_index, iteration_index)
+
+    reader = conn._call(
+        query="select i from range(1000000) t(i)",
+        output_type="arrow_reader",
+        batch_size=2048,
+        batch_bytes=4_000_000,
+    )
+    sizes = [len(batch) for batch in reader]
+
+    assert sum(sizes) == 1_000_000
+    # int64 at ~8 bytes/row -> later batches should be far bigger than 2048
+    assert max(sizes[1:]) > 2048
+    conn.close()
+
+
+def test_adaptive_wide_strings(make_connection, connect_config, thread_index, iteration_index):
+    # Wide VARCHAR rows should produce fewer rows per batch than the target
+    # row count would suggest, but content is unaffected
+    conn = make_connection(thread_index, iteration_index)
+
+    query = "select repeat('x', 1000) as s from range(20000) t(i)"
+    reader = conn._call(query=query, output_type="arrow_reader", batch_bytes=1_000_000)
+    table = reader.read_all()
+
+    assert len(table) == 20_000
+    assert table.column("s")[0].as_py() == "x" * 1000
+    conn.close()
@@ -288,6 +288,64 @@ class TestAppenderWithSchema:
         conn.close()
 
 
+class TestAppenderArrow:
+
+    def test_append_arrow_table(self):
+        pa = pytest.importorskip("pyarrow")
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id BIGINT, name VARCHAR)")
+
+        table = pa.table({"id": [1, 2, 3], "name": ["a", "b", "c"]})
+        with conn.appender("test_table") as app:
+            app.append_arrow(table)
+
+        result = conn.execute("SELECT * FROM test_table ORDER BY id").fetchall()
+        assert result == [(1, "a"), (2, "b"), (3, "c")]
+        conn.close()
+
+    def test_append_arrow_large_batch(self):
+        pa = pytest.importorskip("pyarrow")
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id BIGINT, value DOUBLE)")
+
+        n_rows = 500_000
+        table = pa.table({"id": list(range(n_rows)), "value": [float(i) * 1.5 for i in range(n_rows)]})
+        with conn.appender("test_table") as app:
+            app.append_arrow(table)
+
+        result = conn.execute("SELECT COUNT(*), SUM(id) FROM test_table").fetchone()
+        assert result[0] == n_rows
+        assert result[1] == sum(range(n_rows))
+        conn.close()
+
+    def test_append_arrow_mixed_with_rows(self):
+        pa = pytest.importorskip("pyarrow")
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id BIGINT)")
+
+        with conn.appender("test_table") as app:
+            app.append_row(1)
+            app.append_arrow(pa.table({"id": [2, 3]}))
+            app.append_row(4)
+
+        result = conn.execute("SELECT COUNT(*) FROM test_table").fetchone()
+        assert result[0] == 4
+        conn.close()
+
+    def test_append_arrow_with_schema(self):
+        pa = pytest.importorskip("pyarrow")
+        conn = Connection()
+        conn.execute("CREATE SCHEMA test_schema")
+        conn.execute("CREATE TABLE test_schema.test_table (id BIGINT)")
+
+        with conn.appender("test_table", schema="test_schema") as app:
+            app.append_arrow(pa.table({"id": [42]}))
+
+        result = conn.execute("SELECT * FROM test_schema.test_table").fetchone()
+        assert result[0] == 42
+        conn.close()
+
+
 class TestAppenderLargeData:
 
     def test_appender_many_rows(self):
@@ -320,3 +378,78 @@ class TestAppenderLargeData:
         result = conn.execute("SELECT COUNT(*) FROM test_table").fetchone()
         assert result[0] == 2000
         conn.close()
+
+
+class TestAppenderPipelined:
+
+    def test_pipelined_crosses_rotation_threshold(self):
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id INTEGER, value DOUBLE)")
+
+        # Small flush_rows forces many buffer rotations through the
+        # background flush thread
+        n_rows = 10000
+        with conn.appender("test_table", pipelined=True, flush_rows=512) as app:
+            for i in range(n_rows):
+                app.append_row(i, float(i) * 1.5)
+
+        result = conn.execute("SELECT COUNT(*), SUM(id) FROM test_table").fetchone()
+        assert result[0] == n_rows
+        assert result[1] == sum(range(n_rows))
+        conn.close()
+
+    def test_pipelined_flush_drains_background(self):
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id INTEGER)")
+
+        app = conn.appender("test_table", pipelined=True, flush_rows=100)
+        for i in range(1050):
+            app.append_row(i)
+        app.flush()
+
+        # Everything appended so far must be visible after flush
+        result = conn.execute("SELECT COUNT(*) FROM test_table").fetchone()
+        assert result[0] == 1050
+
+        for i in range(1050, 2000):
+            app.append_row(i)
+        app.close()
+
+        result = conn.execute("SELECT COUNT(*) FROM test_table").fetchone()
+        assert result[0] == 2000
+        conn.close()
+
+    def test_pipelined_extra_buffers(self):
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id INTEGER)")
+
+        with conn.appender("test_table", pipelined=True, flush_rows=256, buffers=4) as app:
+            for i in range(5000):
+                app.append_row(i)
+
+        result = conn.execute("SELECT COUNT(*) FROM test_table").fetchone()
+        assert result[0] == 5000
+        conn.close()
+
+    def test_pipelined_below_threshold(self):
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id INTEGER)")
+
+        # Fewer rows than flush_rows - close must still land everything
+        with conn.appender("test_table", pipelined=True) as app:
+            app.append_row(1)
+            app.append_row(2)
+
+        result = conn.execute("SELECT * FROM test_table ORDER BY id").fetchall()
+        assert result == [(1,), (2,)]
+        conn.close()
+
+    def test_pipelined_invalid_params(self):
+        conn = Connection()
+        conn.execute("CREATE TABLE test_table (id INTEGER)")
+
+        with pytest.raises(ValueError):
+            conn.appender("test_table", pipelined=True, flush_rows=0)
+        with pytest.raises(ValueError):
+            conn.appender("test_table", pipelined=True, buffers=1)
+        conn.close()
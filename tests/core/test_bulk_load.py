@@ -0,0 +1,54 @@
+
+import pytest
+
+import bareduckdb
+
+pa = pytest.importorskip("pyarrow")
+
+
+def test_load_table_create():
+    conn = bareduckdb.connect()
+    table = pa.table({"x": list(range(1000)), "s": [f"row{i}" for i in range(1000)]})
+
+    rows = conn.load_table("t", table)
+    assert rows == 1000
+
+    result = conn.sql("select count(*) as c, sum(x) as s from t").fetchall()
+    assert result == [(1000, sum(range(1000)))]
+
+
+def test_load_table_append():
+    conn = bareduckdb.connect()
+    table = pa.table({"x": [1, 2, 3]})
+
+    conn.load_table("t", table)
+    conn.load_table("t", table, create=False)
+    assert conn.sql("select count(*) as c from t").fetchall() == [(6,)]
+
+
+def test_load_table_replace():
+    conn = bareduckdb.connect()
+
+    conn.load_table("t", pa.table({"x": [1, 2, 3]}))
+    conn.load_table("t", pa.table({"x": [7]}), replace=True)
+    assert conn.sql("select * from t").fetchall() == [(7,)]
+
+
+def test_load_table_parallel_partitions():
+    conn = bareduckdb.connect()
+    # Large enough that the holder splits into multiple partition streams
+    n = 500_000
+    table = pa.table({"x": list(range(n))})
+
+    rows = conn.load_table("t", table, partitions=4)
+    assert rows == n
+    assert conn.sql("select count(*) as c, sum(x) as s from t").fetchall() == [(n, n * (n - 1) // 2)]
+
+
+def test_load_table_from_stream_source():
+    conn = bareduckdb.connect()
+    table = pa.table({"x": [1, 2, 3]})
+    reader = pa.RecordBatchReader.from_batches(table.schema, table.to_batches())
+
+    conn.load_table("t", reader)
+    assert conn.sql("select sum(x) as s from t").fetchall() == [(6,)]
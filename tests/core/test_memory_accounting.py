@@ -0,0 +1,51 @@
+
+import pytest
+
+import bareduckdb
+
+pa = pytest.importorskip("pyarrow")
+
+
+def test_memory_stats_fresh_connection():
+    conn = bareduckdb.connect()
+    stats = conn.memory_stats()
+
+    for key in ("result_bytes", "stream_bytes", "holder_bytes", "total_bytes", "peak_bytes", "limit_bytes"):
+        assert key in stats
+        assert stats[key] >= 0
+    assert stats["limit_bytes"] == 0
+
+
+def test_peak_tracks_materialized_result():
+    conn = bareduckdb.connect()
+
+    result = conn._call(query="select range i from range(100000)", output_type="arrow_table")
+    assert result.num_rows == 100000
+
+    stats = conn.memory_stats()
+    # The consumed arrays were charged while the result was being built,
+    # even though the charge is released once pyarrow owns the buffers
+    assert stats["peak_bytes"] > 0
+
+
+def test_holder_registration_accounted():
+    conn = bareduckdb.connect()
+    table = pa.table({"a": [1, 2, 3], "b": ["x", "y", "z"]})
+
+    conn._register_arrow("t", table)
+    assert conn.memory_stats()["holder_bytes"] > 0
+
+
+def test_memory_limit_blocks_and_lifts():
+    conn = bareduckdb.connect()
+
+    conn.set_memory_limit(1)
+    with pytest.raises(RuntimeError, match="memory limit"):
+        conn._call(query="select range i from range(100000)", output_type="arrow_table")
+
+    conn.set_memory_limit(0)
+    result = conn._call(query="select range i from range(100000)", output_type="arrow_table")
+    assert result.num_rows == 100000
+
+    with pytest.raises(ValueError):
+        conn.set_memory_limit(-1)
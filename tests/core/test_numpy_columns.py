@@ -0,0 +1,77 @@
+"""Direct columnar export: to_numpy_columns() copies DuckDB's collected
+Arrow buffers straight into NumPy arrays, bypassing pyarrow batches."""
+
+import pytest
+import numpy as np
+
+from bareduckdb import Connection
+
+
+class TestNumpyColumns:
+
+    def test_int_and_float_columns(self):
+        conn = Connection()
+        cols = conn._call(
+            query="SELECT range AS id, range * 1.5 AS value FROM range(1000)",
+            output_type="numpy_columns",
+        )
+        assert set(cols.keys()) == {"id", "value"}
+        assert cols["id"].dtype == np.int64
+        assert cols["value"].dtype == np.float64
+        assert len(cols["id"]) == 1000
+        assert cols["id"][500] == 500
+        assert cols["value"][500] == 750.0
+        conn.close()
+
+    def test_matches_arrow_path(self):
+        conn = Connection()
+        query = "SELECT range AS x, (range % 7)::INTEGER AS y FROM range(5000)"
+        cols = conn._call(query=query, output_type="numpy_columns")
+        table = conn._call(query=query, output_type="arrow_table")
+        np.testing.assert_array_equal(cols["x"], table["x"].to_numpy())
+        np.testing.assert_array_equal(cols["y"], table["y"].to_numpy())
+        assert cols["y"].dtype == np.int32
+        conn.close()
+
+    def test_nulls_masked(self):
+        conn = Connection()
+        cols = conn._call(
+            query="SELECT CASE WHEN range % 3 = 0 THEN NULL ELSE range END AS v FROM range(100)",
+            output_type="numpy_columns",
+        )
+        v = cols["v"]
+        assert isinstance(v, np.ma.MaskedArray)
+        assert v.mask[0]
+        assert not v.mask[1]
+        assert v[1] == 1
+        assert int(np.count_nonzero(v.mask)) == 34
+        conn.close()
+
+    def test_timestamp_column(self):
+        conn = Connection()
+        cols = conn._call(
+            query="SELECT TIMESTAMP '2024-01-01 00:00:00' + INTERVAL (range) SECOND AS ts FROM range(10)",
+            output_type="numpy_columns",
+        )
+        assert cols["ts"].dtype == np.dtype("datetime64[us]")
+        assert cols["ts"][1] - cols["ts"][0] == np.timedelta64(1, "s")
+        conn.close()
+
+    def test_unsupported_column_raises(self):
+        conn = Connection()
+        with pytest.raises(RuntimeError, match="does not support column"):
+            conn._call(
+                query="SELECT 'hello' AS s",
+                output_type="numpy_columns",
+            )
+        conn.close()
+
+    def test_empty_result(self):
+        conn = Connection()
+        cols = conn._call(
+            query="SELECT range AS id FROM range(0)",
+            output_type="numpy_columns",
+        )
+        assert len(cols["id"]) == 0
+        assert cols["id"].dtype == np.int64
+        conn.close()
@@ -22,4 +22,72 @@ def test_core_named_parameters():
         assert(result.to_pylist()[-1]["i"] == 6)
 
 
+def test_core_prepared_cache_hot_query():
+    # Repeated parameterized query exercises the prepared statement cache
+    with ConnectionBase(database=":memory:") as conn:
+        for i in range(10):
+            result = conn._call(query="select i from range(10) t(i) where i=?", output_type="arrow_table", parameters=[i])
+            assert(result.to_pylist() == [{"i": i}])
+
+
+def test_core_prepared_cache_ddl_invalidation():
+    with ConnectionBase(database=":memory:") as conn:
+        conn._call(query="create table t1(i bigint)", output_type="arrow_table")
+        conn._call(query="insert into t1 values (1)", output_type="arrow_table", parameters=[])
+        result = conn._call(query="select * from t1 where i=?", output_type="arrow_table", parameters=[1])
+        assert(len(result) == 1)
+
+        # DDL must invalidate cached plans referencing the old table shape
+        conn._call(query="drop table t1", output_type="arrow_table")
+        conn._call(query="create table t1(i bigint, j bigint)", output_type="arrow_table")
+        conn._call(query="insert into t1 values (1, 2)", output_type="arrow_table", parameters=[])
+        result = conn._call(query="select * from t1 where i=?", output_type="arrow_table", parameters=[1])
+        assert(result.to_pylist() == [{"i": 1, "j": 2}])
+
+        # Explicit invalidation is available for out-of-band catalog changes
+        conn._impl.invalidate_prepared_cache()
+
+
+def test_core_execute_many_positional():
+    with ConnectionBase(database=":memory:") as conn:
+        conn._call(query="create table em(i bigint, s varchar)", output_type="arrow_table")
+
+        # Homogeneous columns take the batched fast path
+        count = conn._execute_many("insert into em values (?, ?)", [[i, f"row_{i}"] for i in range(100)])
+        assert(count == 100)
+
+        result = conn._call(query="select count(*) c, sum(i) s from em", output_type="arrow_table")
+        assert(result.to_pylist() == [{"c": 100, "s": 4950}])
+
+
+def test_core_execute_many_mixed_and_nulls():
+    with ConnectionBase(database=":memory:") as conn:
+        conn._call(query="create table em2(i bigint, x double)", output_type="arrow_table")
+
+        # None entries and a mixed column (falls back to per-value conversion)
+        rows = [[1, 1.5], [None, 2.5], [3, None], [4, 5]]
+        count = conn._execute_many("insert into em2 values (?, ?)", rows)
+        assert(count == 4)
+
+        result = conn._call(query="select count(*) c, count(i) ci from em2", output_type="arrow_table")
+        assert(result.to_pylist() == [{"c": 4, "ci": 3}])
+
+
+def test_core_execute_many_named():
+    with ConnectionBase(database=":memory:") as conn:
+        conn._call(query="create table em3(i bigint)", output_type="arrow_table")
+        count = conn._execute_many("insert into em3 values ($v)", [{"v": i} for i in range(5)])
+        assert(count == 5)
+
+        result = conn._call(query="select sum(i) s from em3", output_type="arrow_table")
+        assert(result.to_pylist() == [{"s": 10}])
+
+
+def test_core_execute_many_error():
+    with ConnectionBase(database=":memory:") as conn:
+        conn._call(query="create table em4(i bigint not null)", output_type="arrow_table")
+        with pytest.raises(RuntimeError):
+            conn._execute_many("insert into em4 values (?)", [[1], [None]])
+
+
 test_core_named_parameters()
\ No newline at end of file
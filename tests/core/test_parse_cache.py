@@ -0,0 +1,21 @@
+from bareduckdb.core import ConnectionBase
+
+
+def test_parse_sql_repeated_calls_consistent():
+    # Repeated parses of the same text hit the parse-result cache
+    with ConnectionBase(database=":memory:") as conn:
+        query = "select * from my_table t join other_table o on t.id = o.id"
+        first = conn._impl.parse_sql(query)
+        for _ in range(5):
+            assert conn._impl.parse_sql(query) == first
+
+        assert first["statement_type"] == "SELECT"
+        assert set(first["table_refs"]) == {"my_table", "other_table"}
+
+
+def test_parse_sql_error_cached_consistently():
+    with ConnectionBase(database=":memory:") as conn:
+        bad = "select from from where"
+        first = conn._impl.parse_sql(bad)
+        assert first["error"]
+        assert conn._impl.parse_sql(bad) == first
@@ -0,0 +1,58 @@
+"""Per-phase query timing counters exported from the native layer."""
+
+import pytest
+
+from bareduckdb.core import ConnectionBase
+
+
+@pytest.fixture
+def conn():
+    c = ConnectionBase(database=":memory:")
+    yield c
+    c.enable_query_timings(False)
+    c.reset_query_timings()
+
+
+def test_timings_disabled_by_default(conn):
+    conn.reset_query_timings()
+    conn._call(query="select i from range(1000) t(i)", output_type="arrow_table")
+
+    timings = conn.query_timings()
+    assert all(v == 0 for v in timings.values())
+
+
+def test_timings_cover_execute_and_export(conn):
+    conn.enable_query_timings()
+    conn.reset_query_timings()
+
+    result = conn._call(query="select i from range(10000) t(i)", output_type="arrow_table")
+    assert result.num_rows == 10000
+
+    timings = conn.query_timings()
+    assert timings["execute_ns"] > 0
+    assert timings["batches_exported"] > 0
+    assert timings["rows_exported"] == 10000
+
+
+def test_timings_accumulate_until_reset(conn):
+    conn.enable_query_timings()
+    conn.reset_query_timings()
+
+    conn._call(query="select i from range(100) t(i)", output_type="arrow_table")
+    conn._call(query="select i from range(100) t(i)", output_type="arrow_table")
+    assert conn.query_timings(reset=True)["rows_exported"] == 200
+
+    # reset=True zeroed the counters
+    assert conn.query_timings()["rows_exported"] == 0
+
+
+def test_timings_stop_when_disabled(conn):
+    conn.enable_query_timings()
+    conn.reset_query_timings()
+    conn._call(query="select i from range(50) t(i)", output_type="arrow_table")
+    before = conn.query_timings()
+
+    conn.enable_query_timings(False)
+    conn._call(query="select i from range(50) t(i)", output_type="arrow_table")
+
+    assert conn.query_timings() == before
@@ -0,0 +1,55 @@
+
+import pytest
+
+import bareduckdb
+from bareduckdb.dataset import register_tables
+
+
+def test_inline_register_multiple(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    left = conn._call(query="select * from range(100) t(j)")
+    right = conn._call(query="select * from range(50) t(j)")
+
+    # Two data entries take the batched registration path
+    joined = conn._call(
+        query="select count(*) as n from a join b using (j)",
+        output_type="arrow_table",
+        data={"a": left, "b": right},
+    )
+    assert joined.to_pylist() == [{"n": 50}]
+
+    # Both names were unregistered after the call
+    with pytest.raises(Exception):
+        conn._call(query="select * from a", output_type="arrow_table")
+    conn.close()
+
+
+def test_register_tables_direct():
+    pa = pytest.importorskip("pyarrow")
+    conn = bareduckdb.connect()
+
+    t1 = pa.table({"x": [1, 2, 3]})
+    t2 = pa.table({"y": ["a", "b"]})
+    unsupported = register_tables(conn, {"t1": t1, "t2": t2})
+    assert unsupported == []
+
+    assert conn.sql("select sum(x) as s from t1").fetchall() == [(6,)]
+    assert conn.sql("select count(*) as c from t2").fetchall() == [(2,)]
+
+
+def test_register_tables_replace():
+    pa = pytest.importorskip("pyarrow")
+    conn = bareduckdb.connect()
+
+    register_tables(conn, {"t": pa.table({"x": [1]})})
+    register_tables(conn, {"t": pa.table({"x": [1, 2, 3]})})
+    assert conn.sql("select count(*) as c from t").fetchall() == [(3,)]
+
+
+def test_register_tables_unsupported_reported():
+    conn = bareduckdb.connect()
+
+    # Plain Python objects have no holder; the name comes back to the caller
+    unsupported = register_tables(conn, {"bogus": object()})
+    assert unsupported == ["bogus"]
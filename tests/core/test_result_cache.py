@@ -0,0 +1,113 @@
+"""Opt-in materialized-result reuse keyed by query text and registration
+version."""
+
+import pytest
+
+import bareduckdb
+from bareduckdb.core import ConnectionBase
+
+pa = pytest.importorskip("pyarrow")
+
+QUERY = "select i, i * 2 as d from range(1000) t(i)"
+
+
+def test_cache_disabled_by_default():
+    conn = ConnectionBase(database=":memory:")
+    first = conn._call(query=QUERY, output_type="arrow_table")
+    second = conn._call(query=QUERY, output_type="arrow_table")
+    assert first is not second
+    assert first == second
+
+
+def test_cache_hit_returns_same_table():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache()
+
+    first = conn._call(query=QUERY, output_type="arrow_table")
+    second = conn._call(query=QUERY, output_type="arrow_table")
+    # Identity proves the query was not re-executed
+    assert first is second
+    assert second.num_rows == 1000
+
+
+def test_write_statement_invalidates():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache()
+    conn._call(query="create table t (v bigint)", output_type="arrow_capsule")
+    conn._call(query="insert into t values (1)", output_type="arrow_capsule")
+
+    first = conn._call(query="select count(*) from t", output_type="arrow_table")
+    assert first.column(0).to_pylist() == [1]
+
+    conn._call(query="insert into t values (2)", output_type="arrow_table")
+    second = conn._call(query="select count(*) from t", output_type="arrow_table")
+    assert second.column(0).to_pylist() == [2]
+
+
+def test_cte_prefixed_insert_is_not_cached():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache()
+    conn._call(query="create table t (v bigint)", output_type="arrow_capsule")
+
+    first = conn._call(query="select count(*) from t", output_type="arrow_table")
+    assert first.column(0).to_pylist() == [0]
+
+    # CTE-prefixed DML must neither be served from cache (the write would
+    # be skipped) nor count as read-only (cached SELECTs would go stale)
+    cte_insert = "with cte as (select 1 as v) insert into t select * from cte"
+    conn._call(query=cte_insert, output_type="arrow_table")
+    conn._call(query=cte_insert, output_type="arrow_table")
+
+    second = conn._call(query="select count(*) from t", output_type="arrow_table")
+    assert second.column(0).to_pylist() == [2]
+
+
+def test_reregistration_invalidates():
+    conn = bareduckdb.connect()
+    conn.enable_result_cache()
+
+    conn.register("cached_frame", pa.table({"x": [1, 2, 3]}))
+    first = conn._call(query="select sum(x) from cached_frame", output_type="arrow_table")
+    assert first.column(0).to_pylist() == [6]
+
+    # Same query again is served from cache
+    assert conn._call(query="select sum(x) from cached_frame", output_type="arrow_table") is first
+
+    conn.register("cached_frame", pa.table({"x": [10, 20, 30]}))
+    second = conn._call(query="select sum(x) from cached_frame", output_type="arrow_table")
+    assert second.column(0).to_pylist() == [60]
+
+
+def test_parameters_bypass_cache():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache()
+
+    query = "select ? + 0 as v"
+    first = conn._call(query=query, output_type="arrow_table", parameters=[1])
+    second = conn._call(query=query, output_type="arrow_table", parameters=[2])
+    assert first.column(0).to_pylist() == [1]
+    assert second.column(0).to_pylist() == [2]
+
+
+def test_capacity_evicts_oldest():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache(capacity=2)
+
+    a = conn._call(query="select 1 as a", output_type="arrow_table")
+    conn._call(query="select 2 as b", output_type="arrow_table")
+    conn._call(query="select 3 as c", output_type="arrow_table")
+
+    # "select 1" was evicted - a fresh table comes back
+    again = conn._call(query="select 1 as a", output_type="arrow_table")
+    assert a is not again
+    assert a == again
+
+
+def test_clear_result_cache():
+    conn = ConnectionBase(database=":memory:")
+    conn.enable_result_cache()
+
+    first = conn._call(query=QUERY, output_type="arrow_table")
+    conn.clear_result_cache()
+    second = conn._call(query=QUERY, output_type="arrow_table")
+    assert first is not second
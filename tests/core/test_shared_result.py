@@ -0,0 +1,69 @@
+"""Shared-memory result handoff: write once, map zero-copy elsewhere."""
+
+import multiprocessing
+
+import pytest
+
+import bareduckdb
+from bareduckdb.core import ConnectionBase
+
+pa = pytest.importorskip("pyarrow")
+
+
+def _child_sum(path, queue):
+    table = bareduckdb.read_shared_result(path)
+    queue.put((table.num_rows, sum(table.column("i").to_pylist())))
+
+
+def test_shared_result_roundtrip(tmp_path):
+    conn = ConnectionBase(database=":memory:")
+    result = conn._call(query="select i from range(1000) t(i)", output_type="arrow_table")
+
+    path = bareduckdb.write_shared_result(result, str(tmp_path / "seg.arrow"))
+    table = bareduckdb.read_shared_result(path)
+    assert table.num_rows == 1000
+    assert table.column("i").to_pylist() == list(range(1000))
+
+    bareduckdb.free_shared_result(path)
+
+
+def test_shared_result_reader(tmp_path):
+    conn = ConnectionBase(database=":memory:")
+    reader = conn._call(query="select i from range(5000) t(i)", output_type="arrow_reader", batch_size=1000)
+
+    path = bareduckdb.write_shared_result(reader, str(tmp_path / "seg.arrow"))
+    out = bareduckdb.read_shared_result_reader(path)
+    batches = list(out)
+    assert sum(b.num_rows for b in batches) == 5000
+
+    bareduckdb.free_shared_result(path)
+
+
+def test_result_to_shared(tmp_path):
+    conn = bareduckdb.connect()
+    result = conn.execute("select i, i::varchar s from range(100) t(i)")
+    path = result._last_result.to_shared(str(tmp_path / "seg.arrow"))
+
+    table = bareduckdb.read_shared_result(path)
+    assert table.num_rows == 100
+    assert table.column_names == ["i", "s"]
+
+    bareduckdb.free_shared_result(path)
+
+
+def test_shared_result_cross_process(tmp_path):
+    conn = ConnectionBase(database=":memory:")
+    result = conn._call(query="select i from range(10000) t(i)", output_type="arrow_table")
+    path = bareduckdb.write_shared_result(result, str(tmp_path / "seg.arrow"))
+
+    ctx = multiprocessing.get_context("spawn")
+    queue = ctx.Queue()
+    proc = ctx.Process(target=_child_sum, args=(path, queue))
+    proc.start()
+    num_rows, total = queue.get(timeout=60)
+    proc.join(timeout=60)
+
+    assert num_rows == 10000
+    assert total == sum(range(10000))
+
+    bareduckdb.free_shared_result(path)
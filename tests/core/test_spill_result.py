@@ -0,0 +1,57 @@
+import glob
+import os
+import tempfile
+
+import pytest
+from bareduckdb.core import ConnectionBase
+
+
+def _spill_files() -> list[str]:
+    return glob.glob(os.path.join(tempfile.gettempdir(), "bareduckdb_spill_*"))
+
+
+def test_spill_matches_in_memory(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    query = "select i, 'val_' || i as s from range(200000) t(i)"
+    plain = conn._call(query=query, output_type="arrow_table")
+    # Tiny threshold forces the spill path
+    spilled = conn._call(query=query, output_type="arrow_table", spill_threshold=1024, batch_size=10_000)
+
+    assert spilled.to_pylist() == plain.to_pylist()
+    conn.close()
+
+
+def test_spill_below_threshold_stays_in_memory(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    table = conn._call(query="select * from range(100) t(i)", output_type="arrow_table", spill_threshold=10_000_000)
+    assert len(table) == 100
+    assert table.column("i")[99].as_py() == 99
+    conn.close()
+
+
+def test_spill_leaves_no_temp_files(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    table = conn._call(
+        query="select * from range(100000) t(i)",
+        output_type="arrow_table",
+        spill_threshold=1024,
+        batch_size=10_000,
+    )
+    assert len(table) == 100_000
+    # The spill file is unlinked as soon as the mapping is open
+    assert _spill_files() == []
+    # The mapped data stays readable after unlink
+    assert table.column("i")[-1].as_py() == 99_999
+    conn.close()
+
+
+def test_spill_empty_result(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    table = conn._call(query="select * from range(0) t(i)", output_type="arrow_table", spill_threshold=1024)
+    assert len(table) == 0
+    assert table.schema.names == ["i"]
+    conn.close()
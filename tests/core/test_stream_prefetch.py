@@ -0,0 +1,40 @@
+import pytest
+from bareduckdb.core import ConnectionBase
+
+
+def test_prefetch_reader_roundtrip(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    reader = conn._call(query="select * from range(500000) t(i)", output_type="arrow_reader", prefetch=True)
+    table = reader.read_all()
+
+    assert len(table) == 500_000
+    assert table.column("i")[0].as_py() == 0
+    assert table.column("i")[-1].as_py() == 499_999
+    conn.close()
+
+
+def test_prefetch_matches_plain_stream(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    query = "select i, i * 2 as j from range(100000) t(i)"
+    plain = conn._call(query=query, output_type="arrow_reader").read_all()
+    prefetched = conn._call(query=query, output_type="arrow_reader", prefetch=True).read_all()
+
+    assert plain.to_pylist() == prefetched.to_pylist()
+    conn.close()
+
+
+def test_prefetch_partial_consumption(make_connection, connect_config, thread_index, iteration_index):
+    # Dropping the reader mid-stream must shut the prefetch thread down cleanly
+    conn = make_connection(thread_index, iteration_index)
+
+    reader = conn._call(query="select * from range(500000) t(i)", output_type="arrow_reader", prefetch=True, batch_size=10_000)
+    batch = next(iter(reader))
+    assert len(batch) > 0
+    del reader
+
+    # Connection still usable afterwards
+    table = conn._call(query="select 1 as x", output_type="arrow_table")
+    assert len(table) == 1
+    conn.close()
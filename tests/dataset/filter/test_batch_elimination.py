@@ -0,0 +1,89 @@
+"""Correctness of the native batch-elimination filter stage.
+
+The C++ scan re-checks pushed filters against Arrow buffers and drops
+batches where no row can match. Elimination itself is transparent, so these
+tests verify results stay correct across multi-batch sources, projections,
+conjunctions, and types the Python holder declines to translate.
+"""
+
+import pytest
+import pyarrow as pa
+
+
+class TestBatchEliminationFilters:
+
+    @pytest.fixture
+    def batched_reader(self):
+        # Three batches with disjoint id ranges so selective filters can
+        # eliminate whole batches
+        def make():
+            schema = pa.schema([("id", pa.int64()), ("name", pa.string())])
+            batches = [
+                pa.record_batch(
+                    [pa.array(range(lo, lo + 100)), pa.array([f"row_{i}" for i in range(lo, lo + 100)])],
+                    schema=schema,
+                )
+                for lo in (0, 100, 200)
+            ]
+            return pa.RecordBatchReader.from_batches(schema, batches)
+
+        return make
+
+    def test_selective_int_filter_multi_batch(self, batched_reader, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        conn.register(unique_table_name, batched_reader())
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id >= 250").fetchone()
+        assert result[0] == 50, f"Expected 50 rows with id >= 250, got {result[0]}"
+
+        conn.register(unique_table_name, batched_reader())
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id = 123").fetchone()
+        assert result[0] == 1, f"Expected 1 row with id = 123, got {result[0]}"
+
+    def test_filter_with_projection_reorder(self, batched_reader, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        conn.register(unique_table_name, batched_reader())
+
+        # Filtered column is not the first projected column
+        result = conn.sql(f"SELECT name FROM {unique_table_name} WHERE id = 205").fetchall()
+        assert len(result) == 1
+        assert result[0][0] == "row_205"
+
+    def test_conjunction_filter(self, batched_reader, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        conn.register(unique_table_name, batched_reader())
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id > 110 AND id < 120").fetchone()
+        assert result[0] == 9, f"Expected 9 rows in (110, 120), got {result[0]}"
+
+    def test_string_filter_multi_batch(self, batched_reader, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        conn.register(unique_table_name, batched_reader())
+
+        result = conn.sql(f"SELECT id FROM {unique_table_name} WHERE name = 'row_42'").fetchall()
+        assert len(result) == 1
+        assert result[0][0] == 42
+
+    def test_null_filters_multi_batch(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        schema = pa.schema([("a", pa.int64())])
+        batches = [
+            pa.record_batch([pa.array([1, 2, 3], type=pa.int64())], schema=schema),
+            pa.record_batch([pa.array([None, None, 4], type=pa.int64())], schema=schema),
+            pa.record_batch([pa.array([None, None, None], type=pa.int64())], schema=schema),
+        ]
+        conn.register(unique_table_name, pa.RecordBatchReader.from_batches(schema, batches))
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE a IS NULL").fetchone()
+        assert result[0] == 5, f"Expected 5 NULL rows, got {result[0]}"
+
+        conn.register(unique_table_name, pa.RecordBatchReader.from_batches(schema, batches))
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE a IS NOT NULL").fetchone()
+        assert result[0] == 4, f"Expected 4 non-NULL rows, got {result[0]}"
+
+    def test_no_match_anywhere(self, batched_reader, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+        conn.register(unique_table_name, batched_reader())
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id = 99999").fetchone()
+        assert result[0] == 0, f"Expected 0 rows, got {result[0]}"
@@ -0,0 +1,68 @@
+"""Large IN-lists are delivered to holders as one contiguous typed buffer
+instead of per-element marshalled values."""
+
+import pytest
+import pyarrow as pa
+
+
+class TestInListBuffer:
+    """IN filters above the packing threshold (64 values) take the buffered
+    path; results must match the element-wise path exactly."""
+
+    def test_large_int_in_list(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'id': pa.array(range(10000), type=pa.int64())})
+        conn.register(unique_table_name, table)
+
+        keys = list(range(0, 2000, 7))  # 286 values
+        in_list = ", ".join(str(k) for k in keys)
+        result = conn.sql(f"SELECT count(*), sum(id) FROM {unique_table_name} WHERE id IN ({in_list})").fetchone()
+        assert result[0] == len(keys)
+        assert result[1] == sum(keys)
+
+    def test_large_string_in_list(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({
+            'k': pa.array([f"key_{i:05d}" for i in range(5000)]),
+            'v': pa.array(range(5000), type=pa.int64()),
+        })
+        conn.register(unique_table_name, table)
+
+        keys = [f"key_{i:05d}" for i in range(0, 1000, 9)]  # 112 values
+        in_list = ", ".join(f"'{k}'" for k in keys)
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE k IN ({in_list})").fetchone()
+        assert result[0] == len(keys)
+
+    def test_large_float_in_list(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'x': pa.array([i * 0.5 for i in range(1000)], type=pa.float64())})
+        conn.register(unique_table_name, table)
+
+        keys = [i * 0.5 for i in range(0, 200, 2)]  # 100 values
+        in_list = ", ".join(repr(k) for k in keys)
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE x IN ({in_list})").fetchone()
+        assert result[0] == len(keys)
+
+    def test_small_in_list_still_works(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'id': pa.array(range(100), type=pa.int64())})
+        conn.register(unique_table_name, table)
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id IN (3, 5, 8)").fetchone()
+        assert result[0] == 3
+
+    def test_in_list_on_narrow_int_column(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        # int32 column - the int64 buffer is cast down to the column type
+        table = pa.table({'id': pa.array(range(1000), type=pa.int32())})
+        conn.register(unique_table_name, table)
+
+        keys = list(range(0, 500, 5))  # 100 values
+        in_list = ", ".join(str(k) for k in keys)
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE id IN ({in_list})").fetchone()
+        assert result[0] == len(keys)
@@ -0,0 +1,65 @@
+"""Full-table scans are served from streams pre-exported at registration,
+bypassing the Python produce callback; pushdown queries keep the callback
+path."""
+
+import pytest
+import pyarrow as pa
+
+
+class TestPreexportedStreams:
+
+    def test_full_scan_after_register(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({
+            'id': pa.array(range(1000), type=pa.int64()),
+            'name': pa.array([f"row_{i}" for i in range(1000)]),
+        })
+        conn.register(unique_table_name, table)
+
+        result = conn.sql(f"SELECT * FROM {unique_table_name} ORDER BY id").fetchall()
+        assert len(result) == 1000
+        assert result[0] == (0, "row_0")
+        assert result[-1] == (999, "row_999")
+
+    def test_repeated_full_scans_exhaust_preexports(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'v': pa.array(range(500), type=pa.int64())})
+        conn.register(unique_table_name, table)
+
+        # More scans than pre-exported streams - later ones take the
+        # callback fallback and must return identical data
+        for _ in range(5):
+            result = conn.sql(f"SELECT sum(v) FROM {unique_table_name}").fetchone()
+            assert result[0] == sum(range(500))
+
+    def test_pushdown_queries_unaffected(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({
+            'id': pa.array(range(100), type=pa.int64()),
+            'name': pa.array([f"n{i}" for i in range(100)]),
+        })
+        conn.register(unique_table_name, table)
+
+        # Projection subset and filters never touch pre-exported streams
+        result = conn.sql(f"SELECT name FROM {unique_table_name} WHERE id = 42").fetchall()
+        assert result == [("n42",)]
+
+        result = conn.sql(f"SELECT id FROM {unique_table_name} WHERE id < 10 ORDER BY id").fetchall()
+        assert [r[0] for r in result] == list(range(10))
+
+    def test_reregister_replaces_preexported_data(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'x': pa.array([1, 2, 3], type=pa.int64())})
+        conn.register(unique_table_name, table)
+
+        # Swap before the pre-exported streams are consumed - stale streams
+        # must not leak old rows into the new registration
+        grown = pa.table({'x': pa.array([10, 20, 30, 40], type=pa.int64())})
+        conn.register(unique_table_name, grown)
+
+        result = conn.sql(f"SELECT * FROM {unique_table_name} ORDER BY x").fetchall()
+        assert [r[0] for r in result] == [10, 20, 30, 40]
@@ -0,0 +1,83 @@
+"""Re-registering a growing table swaps the holder in place instead of
+rebuilding the factory and view."""
+
+import pytest
+import pyarrow as pa
+
+
+class TestUpdateHolder:
+
+    def test_reregister_same_schema_updates_in_place(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'id': pa.array([1, 2, 3], type=pa.int64())})
+        conn.register(unique_table_name, table)
+        factory_ptr, _ = conn._holder_factories[unique_table_name]
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name}").fetchone()
+        assert result[0] == 3
+
+        # Append a micro-batch and re-register under the same name
+        grown = pa.table({'id': pa.array([1, 2, 3, 4, 5], type=pa.int64())})
+        conn.register(unique_table_name, grown)
+
+        # Same factory - the swap happened in place
+        assert conn._holder_factories[unique_table_name][0] == factory_ptr
+
+        result = conn.sql(f"SELECT count(*), max(id) FROM {unique_table_name}").fetchone()
+        assert result[0] == 5
+        assert result[1] == 5
+
+    def test_reregister_updates_statistics(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'v': pa.array(range(10), type=pa.int64())})
+        conn.register(unique_table_name, table, statistics=['v'])
+
+        grown = pa.table({'v': pa.array(range(100), type=pa.int64())})
+        conn.register(unique_table_name, grown, statistics=['v'])
+
+        result = conn.sql(f"SELECT count(*) FROM {unique_table_name} WHERE v >= 50").fetchone()
+        assert result[0] == 50
+
+    def test_reregister_schema_change_falls_back(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'id': pa.array([1, 2, 3], type=pa.int64())})
+        conn.register(unique_table_name, table)
+        factory_ptr, _ = conn._holder_factories[unique_table_name]
+
+        # Different column set - must take the full registration path
+        reshaped = pa.table({'id': pa.array([1], type=pa.int64()), 'name': pa.array(['a'])})
+        conn.register(unique_table_name, reshaped)
+
+        assert conn._holder_factories[unique_table_name][0] != factory_ptr
+
+        result = conn.sql(f"SELECT * FROM {unique_table_name}").fetchall()
+        assert result == [(1, 'a')]
+
+    def test_reregister_type_change_falls_back(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        table = pa.table({'id': pa.array([1, 2, 3], type=pa.int64())})
+        conn.register(unique_table_name, table)
+        factory_ptr, _ = conn._holder_factories[unique_table_name]
+
+        # Same column names, different type - an in-place swap would scan
+        # the new buffers with the old cached schema
+        retyped = pa.table({'id': pa.array([1.5, 2.5, 3.5], type=pa.float64())})
+        conn.register(unique_table_name, retyped)
+
+        assert conn._holder_factories[unique_table_name][0] != factory_ptr
+
+        result = conn.sql(f"SELECT sum(id) FROM {unique_table_name}").fetchone()
+        assert result[0] == pytest.approx(7.5)
+
+    def test_update_many_cycles(self, unique_table_name, make_connection, connect_config, thread_index, iteration_index):
+        conn = make_connection(thread_index, iteration_index)
+
+        for size in (10, 100, 1000, 50):
+            table = pa.table({'x': pa.array(range(size), type=pa.int64())})
+            conn.register(unique_table_name, table)
+            result = conn.sql(f"SELECT count(*) FROM {unique_table_name}").fetchone()
+            assert result[0] == size
@@ -197,3 +197,54 @@ class TestIntegration:
 
         result = conn.execute('SELECT * FROM test').fetchall()
         assert len(result) == 3
+
+
+class TestNativeStatsKernel:
+    """The native C++ kernel handles flat numeric columns; its output must
+    match the pyarrow.compute path it replaces."""
+
+    def test_chunked_column_stats(self):
+        chunked = pa.chunked_array([
+            pa.array([5, 1, 9], type=pa.int64()),
+            pa.array([7, -3, 2], type=pa.int64()),
+        ])
+        table = pa.table({'x': chunked})
+        stats = _compute_statistics_arrow(table, ['x'])
+
+        assert len(stats) == 1
+        idx, type_tag, null_count, num_rows, min_int, max_int, _, _, _, _, _ = stats[0]
+        assert type_tag == "int"
+        assert num_rows == 6
+        assert null_count == 0
+        assert min_int == -3
+        assert max_int == 9
+
+    def test_stats_with_nulls(self):
+        table = pa.table({'x': pa.array([None, 4, None, 8], type=pa.int32())})
+        stats = _compute_statistics_arrow(table, ['x'])
+
+        assert len(stats) == 1
+        idx, type_tag, null_count, num_rows, min_int, max_int, _, _, _, _, _ = stats[0]
+        assert type_tag == "int"
+        assert null_count == 2
+        assert num_rows == 4
+        assert min_int == 4
+        assert max_int == 8
+
+    def test_sliced_column_stats(self):
+        # Sliced arrays have a non-zero offset - the kernel must honor it
+        full = pa.array([100, 1, 2, 3, 200], type=pa.int64())
+        table = pa.table({'x': full.slice(1, 3)})
+        stats = _compute_statistics_arrow(table, ['x'])
+
+        assert len(stats) == 1
+        _, type_tag, _, num_rows, min_int, max_int, _, _, _, _, _ = stats[0]
+        assert type_tag == "int"
+        assert num_rows == 3
+        assert min_int == 1
+        assert max_int == 3
+
+    def test_nan_column_skips_stats(self):
+        table = pa.table({'x': pa.array([1.0, float('nan'), 3.0], type=pa.float64())})
+        stats = _compute_statistics_arrow(table, ['x'])
+        assert stats == []
@@ -0,0 +1,64 @@
+import pytest
+
+pa = pytest.importorskip("pyarrow")
+
+from bareduckdb.data_sources.arrow_holder import ArrowHolder
+
+NUM_ROWS = 300_000  # large enough for ArrowHolder to split into slices
+
+
+def test_produce_filtered_partitioned_slices():
+    table = pa.table({"i": list(range(NUM_ROWS))})
+    holder = ArrowHolder(table)
+
+    capsules = holder.produce_filtered_partitioned(["i"], None, 8)
+    assert capsules is not None
+    assert 1 < len(capsules) <= 8
+
+    total = 0
+    for capsule in capsules:
+        reader = pa.RecordBatchReader._import_from_c_capsule(capsule)
+        total += reader.read_all().num_rows
+    assert total == NUM_ROWS
+
+
+def test_produce_filtered_partitioned_declines_filters():
+    table = pa.table({"i": list(range(NUM_ROWS))})
+    holder = ArrowHolder(table)
+
+    filters = {0: {"type": 0, "comparison": 25, "value": 1}}
+    assert holder.produce_filtered_partitioned(["i"], filters, 8) is None
+
+
+def test_partitioned_scan_release_stress(make_connection, connect_config, thread_index, iteration_index):
+    """Repeated partitioned scans with re-registration in between.
+
+    Each scan queues its partition capsules for deferred release from
+    DuckDB's scan threads; every re-registration flushes the queue. Verifies
+    results stay correct while the release path churns.
+    """
+    conn = make_connection(thread_index, iteration_index)
+
+    table = pa.table({"i": list(range(NUM_ROWS))})
+    expected = sum(range(NUM_ROWS))
+
+    for _ in range(5):
+        conn._register_arrow("bigdata", table)
+        result = conn._call(query="select count(*) c, sum(i) s from bigdata", output_type="arrow_table")
+        row = result.to_pylist()[0]
+        assert row["c"] == NUM_ROWS
+        assert row["s"] == expected
+    conn.close()
+
+
+def test_partitioned_register_roundtrip(make_connection, connect_config, thread_index, iteration_index):
+    conn = make_connection(thread_index, iteration_index)
+
+    table = pa.table({"i": list(range(NUM_ROWS))})
+    conn._register_arrow("bigdata", table)
+
+    result = conn._call(query="select count(*) c, sum(i) s from bigdata", output_type="arrow_table")
+    row = result.to_pylist()[0]
+    assert row["c"] == NUM_ROWS
+    assert row["s"] == sum(range(NUM_ROWS))
+    conn.close()